@@ -0,0 +1,314 @@
+/// @author - Brandon Wallace
+/// @file - arena.hpp
+/// @brief - Huge-Page Node Arena
+
+#ifndef arena_hpp
+#define arena_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ----------------------------------------------------------------------------
+
+/// HugePageArena is a node source for LL that carves nodes out of 2 MiB
+/// chunks. Packing a large list into a few huge pages keeps traversal within a
+/// handful of TLB entries instead of one per 4 KiB page.
+///
+/// Each chunk is first requested with MAP_HUGETLB. When no huge pages are
+/// reserved, the arena falls back to a 2 MiB aligned mapping marked with
+/// MADV_HUGEPAGE so transparent huge pages can back it. On request, chunks are
+/// bound to the NUMA node of the thread that constructed the arena.
+///
+/// Freed nodes go on a free list per 16-byte size class and are reused before
+/// the bump pointer moves. Memory is returned to the system only when the
+/// arena is destroyed. Blocks larger than max_block go to the upstream
+/// resource.
+///
+/// @note Not thread-safe, like std::pmr::unsynchronized_pool_resource.
+/// @note On systems other than Linux, chunks come from aligned operator new.
+
+class HugePageArena : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t chunk_size = std::size_t(2) << 20;  ///< 2 MiB
+    static constexpr std::size_t granule    = 16;
+    static constexpr std::size_t max_block  = 1024;
+
+    /// @brief Counters describing how chunks were obtained.
+    struct Stats {
+        std::size_t chunks       = 0;  ///< Chunks mapped.
+        std::size_t hugetlb      = 0;  ///< Chunks backed by MAP_HUGETLB.
+        std::size_t thp_advised  = 0;  ///< Fallback chunks marked MADV_HUGEPAGE.
+        std::size_t numa_bound   = 0;  ///< Chunks bound to numa_node().
+        std::size_t bytes_mapped = 0;  ///< Total bytes reserved.
+        std::size_t bytes_used   = 0;  ///< Bytes currently handed out.
+    };
+
+    /// ----------------------------------------------------------------------
+    /// @name HugePageArena
+    /// @param bind_numa   binds chunks to the calling thread's NUMA node
+    /// @param upstream    resource for blocks larger than max_block
+    /// ----------------------------------------------------------------------
+    explicit HugePageArena(bool bind_numa = false,
+                           std::pmr::memory_resource* upstream =
+                               std::pmr::new_delete_resource());
+
+    /// ----------------------------------------------------------------------
+    /// @name ~HugePageArena
+    /// @note Destructor. Unmaps every chunk; all nodes must be gone by now.
+    /// ----------------------------------------------------------------------
+    ~HugePageArena() override;
+
+    HugePageArena(const HugePageArena&) = delete;
+    HugePageArena& operator=(const HugePageArena&) = delete;
+
+    // @name: stats()
+    // @return: Returns the chunk and usage counters
+    const Stats& stats() const { return m_stats; }
+
+    // @name: numa_node()
+    // @return: Returns the node chunks are bound to, or -1 if unbound
+    int numa_node() const { return m_node; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void  do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    /// @brief A freed block, threaded onto its size class's free list.
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static std::size_t size_class(std::size_t bytes, std::size_t alignment)
+    {
+        std::size_t size = bytes > alignment ? bytes : alignment;
+        return (size + granule - 1) / granule;
+    }
+
+    void  map_chunk();
+    void* reserve(std::size_t bytes);
+    void  unmap(void* chunk) noexcept;
+
+    std::pmr::memory_resource* m_upstream;
+    int                        m_node;
+    char*                      m_cursor;
+    char*                      m_limit;
+    FreeBlock*                 m_free[max_block / granule + 1];
+    std::vector<void*>         m_chunks;
+    Stats                      m_stats;
+};
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+inline HugePageArena::HugePageArena(bool bind_numa,
+                                    std::pmr::memory_resource* upstream)
+: m_upstream(upstream), m_node(-1), m_cursor(nullptr), m_limit(nullptr),
+  m_free()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    // Remembers the node of the creating thread
+    if (bind_numa)
+    {
+        unsigned cpu = 0, node = 0;
+
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        {
+            m_node = static_cast<int>(node);
+        }
+    }
+#else
+    (void)bind_numa;
+#endif
+}
+
+inline HugePageArena::~HugePageArena()
+{
+    for (void* chunk : m_chunks)
+    {
+        unmap(chunk);
+    }
+}
+
+// -----------------------------------------------------------------------
+
+inline void HugePageArena::map_chunk()
+{
+    void* chunk   = nullptr;
+    bool  hugetlb = false;
+
+#if defined(__linux__)
+  #if defined(MAP_HUGETLB)
+    // Explicit huge pages, only available if the admin reserved some
+    chunk = mmap(nullptr, chunk_size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+    if (chunk == MAP_FAILED)
+    {
+        chunk = nullptr;
+    }
+    else
+    {
+        hugetlb = true;
+    }
+  #endif
+
+    // Falls back to a 2 MiB aligned mapping that THP can back
+    if (chunk == nullptr)
+    {
+        void* raw = mmap(nullptr, chunk_size * 2, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (raw == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        // Trims the slack on both sides so the chunk is aligned
+        std::uintptr_t base    = reinterpret_cast<std::uintptr_t>(raw);
+        std::uintptr_t aligned = (base + chunk_size - 1) & ~(chunk_size - 1);
+
+        if (aligned != base)
+        {
+            munmap(raw, aligned - base);
+        }
+        munmap(reinterpret_cast<void*>(aligned + chunk_size),
+               base + chunk_size * 2 - (aligned + chunk_size));
+
+        chunk = reinterpret_cast<void*>(aligned);
+
+      #if defined(MADV_HUGEPAGE)
+        if (madvise(chunk, chunk_size, MADV_HUGEPAGE) == 0)
+        {
+            m_stats.thp_advised++;
+        }
+      #endif
+    }
+
+  #if defined(SYS_mbind)
+    // Prefers the creating thread's node; the kernel falls back to other
+    // nodes instead of failing when it runs out
+    if (m_node >= 0 && m_node < 64)
+    {
+        const int     mpol_preferred = 1;
+        unsigned long mask           = 1UL << m_node;
+
+        if (syscall(SYS_mbind, chunk, chunk_size, mpol_preferred, &mask,
+                    sizeof(mask) * 8, 0) == 0)
+        {
+            m_stats.numa_bound++;
+        }
+    }
+  #endif
+#else
+    chunk = ::operator new(chunk_size, std::align_val_t(chunk_size));
+#endif
+
+    // Records the chunk before using it so it is always released
+    try
+    {
+        m_chunks.push_back(chunk);
+    }
+    catch (...)
+    {
+        unmap(chunk);
+        throw;
+    }
+
+    m_stats.chunks++;
+    m_stats.hugetlb += hugetlb ? 1 : 0;
+    m_stats.bytes_mapped += chunk_size;
+
+    m_cursor = static_cast<char*>(chunk);
+    m_limit  = m_cursor + chunk_size;
+}
+
+inline void HugePageArena::unmap(void* chunk) noexcept
+{
+#if defined(__linux__)
+    munmap(chunk, chunk_size);
+#else
+    ::operator delete(chunk, std::align_val_t(chunk_size));
+#endif
+}
+
+// -----------------------------------------------------------------------
+
+inline void* HugePageArena::reserve(std::size_t bytes)
+{
+    // Starts a new chunk when the current one cannot fit the block; the
+    // leftover tail of the old chunk is abandoned
+    if (m_cursor == nullptr || static_cast<std::size_t>(m_limit - m_cursor) < bytes)
+    {
+        map_chunk();
+    }
+
+    void* p = m_cursor;
+    m_cursor += bytes;
+
+    return p;
+}
+
+// -----------------------------------------------------------------------
+
+inline void* HugePageArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    // Oversized or over-aligned blocks go upstream
+    if (bytes > max_block || alignment > granule)
+    {
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    std::size_t cls = size_class(bytes, alignment);
+    void* p;
+
+    // Reuses a freed block of the same class if there is one
+    if (m_free[cls] != nullptr)
+    {
+        FreeBlock* block = m_free[cls];
+        m_free[cls] = block->next;
+        p = block;
+    }
+    else
+    {
+        p = reserve(cls * granule);
+    }
+
+    m_stats.bytes_used += cls * granule;
+
+    return p;
+}
+
+inline void HugePageArena::do_deallocate(void* p, std::size_t bytes,
+                                         std::size_t alignment)
+{
+    if (bytes > max_block || alignment > granule)
+    {
+        m_upstream->deallocate(p, bytes, alignment);
+        return;
+    }
+
+    std::size_t cls = size_class(bytes, alignment);
+
+    // Pushes the block onto its class's free list
+    FreeBlock* block = ::new (p) FreeBlock{m_free[cls]};
+    m_free[cls] = block;
+
+    m_stats.bytes_used -= cls * granule;
+}
+
+#endif /* arena_hpp */
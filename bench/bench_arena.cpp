@@ -0,0 +1,232 @@
+/// @author - Brandon Wallace
+/// @file - bench/bench_arena.cpp
+/// @brief - Iteration over a new-based LL vs a HugePageArena-backed LL
+///
+/// Build: g++ -std=c++17 -O2 -I. bench/bench_arena.cpp
+/// Usage: ./a.out [nodes] [passes] [--numa]
+///
+/// Both lists are built while unrelated blocks are allocated in between, the
+/// way nodes of a long-lived list get scattered in a real process. Each pass
+/// sums the list. dTLB read misses are counted with perf_event_open where the
+/// kernel allows it (see /proc/sys/kernel/perf_event_paranoid).
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "arena.hpp"
+#include "dll.cpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#endif
+
+// -----------------------------------------------------------------------
+
+/// dTLB read-miss counter for the calling thread; inert if unavailable.
+class TlbCounter {
+public:
+    TlbCounter() : m_fd(-1)
+    {
+#if defined(__linux__) && defined(SYS_perf_event_open)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+
+        attr.type           = PERF_TYPE_HW_CACHE;
+        attr.size           = sizeof(attr);
+        attr.config         = PERF_COUNT_HW_CACHE_DTLB |
+                              (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+
+        m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~TlbCounter()
+    {
+#if defined(__linux__)
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+        }
+#endif
+    }
+
+    bool available() const { return m_fd >= 0; }
+
+    void start()
+    {
+#if defined(__linux__)
+        if (m_fd >= 0)
+        {
+            ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Returns the misses since start(), or -1 if counting is unavailable
+    long long stop()
+    {
+        long long value = -1;
+#if defined(__linux__)
+        if (m_fd >= 0)
+        {
+            ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+            if (read(m_fd, &value, sizeof(value)) != sizeof(value))
+            {
+                value = -1;
+            }
+        }
+#endif
+        return value;
+    }
+
+private:
+    int m_fd;
+};
+
+// -----------------------------------------------------------------------
+
+// Number of distinct pages of the given size that hold the list's nodes
+static std::size_t pages_touched(LL<long>& list, std::uintptr_t page)
+{
+    std::set<std::uintptr_t> pages;
+
+    for (auto& value : list)
+    {
+        pages.insert(reinterpret_cast<std::uintptr_t>(&value) / page);
+    }
+
+    return pages.size();
+}
+
+// AnonHugePages of the whole process, from smaps_rollup
+static std::string anon_huge_pages()
+{
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string   line;
+
+    while (std::getline(smaps, line))
+    {
+        if (line.rfind("AnonHugePages:", 0) == 0)
+        {
+            return line.substr(line.find_first_not_of(' ', 14));
+        }
+    }
+
+    return "n/a";
+}
+
+// Builds the list with noise allocations in between, then frees the noise
+static void build(LL<long>& list, long nodes, std::mt19937& rng)
+{
+    std::vector<char*> noise;
+    noise.reserve(static_cast<std::size_t>(nodes));
+
+    for (long i = 0; i < nodes; ++i)
+    {
+        list.push_back(i);
+        noise.push_back(new char[16 + rng() % 240]);
+    }
+
+    for (char* block : noise)
+    {
+        delete[] block;
+    }
+}
+
+static void measure(const char* name, LL<long>& list, int passes)
+{
+    TlbCounter counter;
+    long       sum = 0;
+
+    counter.start();
+    auto start = std::chrono::steady_clock::now();
+
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        for (long value : list)
+        {
+            sum += value;
+        }
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    long long misses = counter.stop();
+
+    double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    double per_node = ms * 1e6 / (double(list.size()) * passes);
+
+    std::printf("%-10s %9.2f ms %7.2f ns/node  4K pages %8zu  2M pages %6zu  dTLB misses ",
+                name, ms, per_node,
+                pages_touched(list, std::uintptr_t(4) << 10),
+                pages_touched(list, std::uintptr_t(2) << 20));
+
+    if (misses >= 0)
+    {
+        std::printf("%lld (%.3f/node)\n", misses,
+                    double(misses) / (double(list.size()) * passes));
+    }
+    else
+    {
+        std::printf("n/a\n");
+    }
+
+    if (sum == 42)
+    {
+        std::puts("");  // Keeps the loop from being optimised away
+    }
+}
+
+// -----------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    long nodes     = argc > 1 ? std::atol(argv[1]) : 4000000;
+    int  passes    = argc > 2 ? std::atoi(argv[2]) : 5;
+    bool bind_numa = argc > 3 && std::strcmp(argv[3], "--numa") == 0;
+
+    std::mt19937 rng(7);
+
+    std::printf("nodes: %ld  passes: %d  numa binding: %s\n",
+                nodes, passes, bind_numa ? "on" : "off");
+
+    if (!TlbCounter().available())
+    {
+        std::printf("perf_event_open unavailable; dTLB misses not reported\n");
+    }
+
+    HugePageArena arena(bind_numa);
+
+    LL<long> plain;
+    LL<long> pooled(&arena);
+
+    build(plain, nodes, rng);
+    build(pooled, nodes, rng);
+
+    measure("new", plain, passes);
+    measure("arena", pooled, passes);
+
+    const HugePageArena::Stats& stats = arena.stats();
+
+    std::printf("arena: %zu chunks (%zu MAP_HUGETLB, %zu MADV_HUGEPAGE, %zu NUMA-bound"
+                " to node %d), %zu MiB mapped, %zu MiB in use\n",
+                stats.chunks, stats.hugetlb, stats.thp_advised, stats.numa_bound,
+                arena.numa_node(), stats.bytes_mapped >> 20, stats.bytes_used >> 20);
+    std::printf("process AnonHugePages: %s\n", anon_huge_pages().c_str());
+
+    return 0;
+}
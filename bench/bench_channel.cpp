@@ -0,0 +1,269 @@
+/// @author - Brandon Wallace
+/// @file - bench/bench_channel.cpp
+/// @brief - Channel throughput and latency vs busy-polling an LL
+///
+/// Build: g++ -std=c++20 -O2 -pthread -I. bench/bench_channel.cpp
+/// Usage: ./a.out [items] [round-trips]
+///
+/// The baseline is the pipeline this replaces: stages share a mutex-guarded
+/// LL and the consumer spins on empty(). Both wall time and process CPU time
+/// are reported, because a spinning consumer burns a core even when idle.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+#include "channel.hpp"
+
+// -----------------------------------------------------------------------
+
+/// Mutex-guarded LL that consumers poll.
+struct PolledQueue {
+    std::mutex mutex;
+    LL<long>   list;
+
+    void push(long value)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.push_back(value);
+    }
+
+    // Polls until a value is available, yielding between polls
+    long pop()
+    {
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (!list.empty())
+                {
+                    long value = list.front();
+                    list.pop_front();
+                    return value;
+                }
+            }
+
+            std::this_thread::yield();
+        }
+    }
+};
+
+struct Timer {
+    std::chrono::steady_clock::time_point wall = std::chrono::steady_clock::now();
+    std::clock_t                          cpu  = std::clock();
+
+    void report(const char* name, long ops, const char* unit) const
+    {
+        double wall_ms = std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - wall).count();
+        double cpu_ms  = 1000.0 * double(std::clock() - cpu) / CLOCKS_PER_SEC;
+
+        std::printf("%-28s %10.2f ms wall %10.2f ms cpu %10.1f ns/%s\n",
+                    name, wall_ms, cpu_ms, wall_ms * 1e6 / double(ops), unit);
+    }
+};
+
+// Blocks the calling thread until a coroutine sets flag
+static void await_flag(std::atomic<bool>& flag)
+{
+    flag.wait(false);
+}
+
+static void set_flag(std::atomic<bool>& flag)
+{
+    flag.store(true);
+    flag.notify_all();
+}
+
+// -----------------------------------------------------------------------
+//                          T H R O U G H P U T
+// -----------------------------------------------------------------------
+
+static Task produce(Channel<long>& ch, long n)
+{
+    for (long i = 0; i < n; ++i)
+    {
+        co_await ch.send(i);
+    }
+
+    ch.close();
+}
+
+static Task consume(Channel<long>& ch, long& sum, std::atomic<bool>& done)
+{
+    while (auto value = co_await ch.recv())
+    {
+        sum += *value;
+    }
+
+    set_flag(done);
+}
+
+static Task consume_batches(Channel<long>& ch, long& sum, std::atomic<bool>& done)
+{
+    for (;;)
+    {
+        LL<long> batch = co_await ch.recv_n(64);
+
+        if (batch.empty())
+        {
+            break;
+        }
+
+        for (long value : batch)
+        {
+            sum += value;
+        }
+    }
+
+    set_flag(done);
+}
+
+static void throughput(long n)
+{
+    std::printf("-- throughput, %ld items --\n", n);
+
+    {
+        PolledQueue queue;
+        long sum = 0;
+        Timer timer;
+
+        std::thread consumer([&] {
+            for (long i = 0; i < n; ++i)
+            {
+                sum += queue.pop();
+            }
+        });
+
+        for (long i = 0; i < n; ++i)
+        {
+            queue.push(i);
+        }
+
+        consumer.join();
+        timer.report("polled LL, 2 threads", n, "item");
+    }
+
+    {
+        LoopExecutor loop;
+        Channel<long> ch(loop, 256);
+        std::atomic<bool> done(false);
+        long sum = 0;
+        Timer timer;
+
+        spawn(loop, consume(ch, sum, done));
+        spawn(loop, produce(ch, n));
+        loop.run();
+        timer.report("channel, loop executor", n, "item");
+    }
+
+    {
+        Scheduler scheduler(2);
+        PoolExecutor pool(scheduler);
+        Channel<long> ch(pool, 256);
+        std::atomic<bool> done(false);
+        long sum = 0;
+        Timer timer;
+
+        spawn(pool, consume(ch, sum, done));
+        spawn(pool, produce(ch, n));
+        await_flag(done);
+        timer.report("channel recv, pool(2)", n, "item");
+    }
+
+    {
+        Scheduler scheduler(2);
+        PoolExecutor pool(scheduler);
+        Channel<long> ch(pool, 256);
+        std::atomic<bool> done(false);
+        long sum = 0;
+        Timer timer;
+
+        spawn(pool, consume_batches(ch, sum, done));
+        spawn(pool, produce(ch, n));
+        await_flag(done);
+        timer.report("channel recv_n(64), pool(2)", n, "item");
+    }
+}
+
+// -----------------------------------------------------------------------
+//                             L A T E N C Y
+// -----------------------------------------------------------------------
+
+static Task ping(Channel<long>& out, Channel<long>& in, long rounds,
+                 std::atomic<bool>& done)
+{
+    for (long i = 0; i < rounds; ++i)
+    {
+        co_await out.send(i);
+        co_await in.recv();
+    }
+
+    out.close();
+    set_flag(done);
+}
+
+static Task pong(Channel<long>& in, Channel<long>& out)
+{
+    while (auto value = co_await in.recv())
+    {
+        co_await out.send(*value);
+    }
+}
+
+static void latency(long rounds)
+{
+    std::printf("-- ping-pong latency, %ld round trips --\n", rounds);
+
+    {
+        PolledQueue there, back;
+        Timer timer;
+
+        std::thread echo([&] {
+            for (long i = 0; i < rounds; ++i)
+            {
+                back.push(there.pop());
+            }
+        });
+
+        for (long i = 0; i < rounds; ++i)
+        {
+            there.push(i);
+            back.pop();
+        }
+
+        echo.join();
+        timer.report("polled LL, 2 threads", rounds, "rtt");
+    }
+
+    {
+        Scheduler scheduler(2);
+        PoolExecutor pool(scheduler);
+        Channel<long> there(pool, 1), back(pool, 1);
+        std::atomic<bool> done(false);
+        Timer timer;
+
+        spawn(pool, pong(there, back));
+        spawn(pool, ping(there, back, rounds, done));
+        await_flag(done);
+        timer.report("channel, pool(2)", rounds, "rtt");
+    }
+}
+
+// -----------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    long items  = argc > 1 ? std::atol(argv[1]) : 2000000;
+    long rounds = argc > 2 ? std::atol(argv[2]) : 100000;
+
+    throughput(items);
+    latency(rounds);
+
+    return 0;
+}
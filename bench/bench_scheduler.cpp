@@ -0,0 +1,280 @@
+/// @author - Brandon Wallace
+/// @file - bench/bench_scheduler.cpp
+/// @brief - Fork-join benchmark: work-stealing Scheduler vs mutex-guarded LL
+///
+/// Build: g++ -std=c++17 -O2 -pthread -I. bench/bench_scheduler.cpp
+/// Usage: ./a.out [workers] [fib-n]
+///
+/// The baseline is the pool this replaces. Each worker owns an LL of tasks.
+/// The owner uses push_back/pop_back, and other threads steal with
+/// pop_front. Every one of these operations takes that worker's mutex.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "scheduler.hpp"
+
+// -----------------------------------------------------------------------
+
+/// Thread pool whose per-worker queues are mutex-guarded LLs.
+class MutexPool {
+public:
+    using task_type = std::function<void()>;
+
+    explicit MutexPool(std::size_t workers) : m_stop(false)
+    {
+        for (std::size_t i = 0; i < workers; ++i)
+        {
+            m_queues.emplace_back(new Queue());
+        }
+
+        for (std::size_t i = 0; i < workers; ++i)
+        {
+            m_threads.emplace_back([this, i] { loop(i); });
+        }
+    }
+
+    ~MutexPool()
+    {
+        m_stop.store(true);
+
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+
+        for (auto& queue : m_queues)
+        {
+            for (auto* task : queue->tasks)
+            {
+                delete task;
+            }
+        }
+    }
+
+    void submit(task_type task)
+    {
+        std::size_t index = tls_owner == this ? tls_index : 0;
+        Queue& queue = *m_queues[index];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(new task_type(std::move(task)));
+    }
+
+    bool is_worker() const { return tls_owner == this; }
+
+    bool run_one()
+    {
+        std::size_t n     = m_queues.size();
+        std::size_t index = tls_owner == this ? tls_index : n;
+        task_type*  task  = nullptr;
+
+        // Own queue from the back
+        if (index < n)
+        {
+            Queue& own = *m_queues[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+
+            if (!own.tasks.empty())
+            {
+                task = own.tasks.back();
+                own.tasks.pop_back();
+            }
+        }
+
+        // Others from the front
+        for (std::size_t k = 0; task == nullptr && k < n; ++k)
+        {
+            std::size_t victim = (index + 1 + k) % n;
+
+            if (victim == index)
+            {
+                continue;
+            }
+
+            Queue& other = *m_queues[victim];
+            std::lock_guard<std::mutex> lock(other.mutex);
+
+            if (!other.tasks.empty())
+            {
+                task = other.tasks.front();
+                other.tasks.pop_front();
+            }
+        }
+
+        if (task == nullptr)
+        {
+            return false;
+        }
+
+        std::unique_ptr<task_type> owned(task);
+        (*owned)();
+
+        return true;
+    }
+
+private:
+    struct Queue {
+        std::mutex     mutex;
+        LL<task_type*> tasks;
+    };
+
+    void loop(std::size_t index)
+    {
+        tls_owner = this;
+        tls_index = index;
+
+        while (!m_stop.load(std::memory_order_relaxed))
+        {
+            if (!run_one())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static inline thread_local const MutexPool* tls_owner = nullptr;
+    static inline thread_local std::size_t      tls_index = 0;
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread>            m_threads;
+    std::atomic<bool>                   m_stop;
+};
+
+// -----------------------------------------------------------------------
+
+/// Minimal fork-join group usable with either pool.
+template <class Pool>
+class Group {
+public:
+    explicit Group(Pool& pool) : m_pool(pool), m_pending(0) {}
+
+    template <class F>
+    void run(F fn)
+    {
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        m_pool.submit([this, fn]() mutable {
+            fn();
+            m_pending.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // Only pool threads help, as in TaskGroup
+    void wait()
+    {
+        bool help = m_pool.is_worker();
+
+        while (m_pending.load(std::memory_order_acquire) != 0)
+        {
+            if (!help || !m_pool.run_one())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    Pool&                    m_pool;
+    std::atomic<std::size_t> m_pending;
+};
+
+template <class Pool>
+long fib(Pool& pool, int n)
+{
+    if (n < 2)
+    {
+        return n;
+    }
+
+    long a = 0, b = 0;
+
+    Group<Pool> group(pool);
+    group.run([&] { a = fib(pool, n - 1); });
+    b = fib(pool, n - 2);
+    group.wait();
+
+    return a + b;
+}
+
+// Recursive range split with a tiny leaf, stressing spawn and steal
+template <class Pool>
+long sum_range(Pool& pool, long lo, long hi)
+{
+    if (hi - lo <= 64)
+    {
+        long s = 0;
+
+        for (long i = lo; i < hi; ++i)
+        {
+            s += i;
+        }
+
+        return s;
+    }
+
+    long mid = lo + (hi - lo) / 2;
+    long a = 0, b = 0;
+
+    Group<Pool> group(pool);
+    group.run([&] { a = sum_range(pool, lo, mid); });
+    b = sum_range(pool, mid, hi);
+    group.wait();
+
+    return a + b;
+}
+
+template <class F>
+double time_ms(F fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <class Pool>
+void run(const char* name, Pool& pool, int n)
+{
+    long result = 0;
+
+    // Warm-up
+    fib(pool, 20);
+
+    double fib_ms = time_ms([&] { result = fib(pool, n); });
+    std::printf("%-10s fib(%-2d)       = %-14ld %9.2f ms\n", name, n, result, fib_ms);
+
+    double sum_ms = time_ms([&] { result = sum_range(pool, 0, 1L << 22); });
+    std::printf("%-10s sum_range(4M) = %-14ld %9.2f ms\n", name, result, sum_ms);
+}
+
+// -----------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    std::size_t workers = argc > 1 ? std::strtoul(argv[1], nullptr, 10)
+                                   : std::max(1u, std::thread::hardware_concurrency());
+    int         n       = argc > 2 ? std::atoi(argv[2]) : 27;
+
+    std::printf("workers: %zu\n", workers);
+
+    {
+        Scheduler scheduler(workers);
+        run("ws-deque", scheduler, n);
+    }
+
+    {
+        MutexPool pool(workers);
+        run("mutex-LL", pool, n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,213 @@
+/// @author - Brandon Wallace
+/// @file - bench/bench_sorted_list.cpp
+/// @brief - SortedList vs sorted LL insertion vs std::multiset
+///
+/// Build: g++ -std=c++17 -O2 -I. bench/bench_sorted_list.cpp
+/// Usage: ./a.out [n] [ll-n]
+///
+/// The sorted LL baseline finds each insertion point by scanning from
+/// begin(), which is O(n) per insert. It runs on a smaller ll-n so the
+/// benchmark finishes; the per-op times are the numbers to compare.
+///
+/// The erase(it) case uses only 16 distinct keys, so every element sits in a
+/// long run of equal ones, and erases through stored iterators in random
+/// order.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "dll.cpp"
+#include "sorted_list.hpp"
+
+// -----------------------------------------------------------------------
+
+template <class F>
+static double time_ms(F fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+static void report(const char* container, const char* op, std::size_t n, double ms)
+{
+    std::printf("%-12s %-16s n=%-9zu %10.2f ms %10.1f ns/op\n",
+                container, op, n, ms, ms * 1e6 / double(n));
+}
+
+// Inserts keeping LL sorted, scanning for the first greater element
+static void sorted_insert(LL<int>& list, int key)
+{
+    auto it = list.begin();
+
+    while (it != list.end() && !(key < *it))
+    {
+        ++it;
+    }
+
+    list.insert(it, key);
+}
+
+// -----------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    std::size_t n    = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::size_t ll_n = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+
+    std::mt19937 rng(11);
+    std::vector<int> keys(n), probes(n);
+
+    for (auto& key : keys)
+    {
+        key = static_cast<int>(rng());
+    }
+
+    for (auto& probe : probes)
+    {
+        probe = static_cast<int>(rng());
+    }
+
+    long sink = 0;
+
+    // Random insertion
+    {
+        LL<int> list;
+        double ms = time_ms([&] {
+            for (std::size_t i = 0; i < ll_n; ++i)
+            {
+                sorted_insert(list, keys[i]);
+            }
+        });
+        report("sorted LL", "insert", ll_n, ms);
+    }
+
+    SortedList<int>    skip;
+    std::multiset<int> tree;
+
+    report("SortedList", "insert", n, time_ms([&] {
+        for (int key : keys)
+        {
+            skip.insert(key);
+        }
+    }));
+
+    report("std::set", "insert", n, time_ms([&] {
+        for (int key : keys)
+        {
+            tree.insert(key);
+        }
+    }));
+
+    // Lookups
+    report("SortedList", "lower_bound", n, time_ms([&] {
+        for (int probe : probes)
+        {
+            auto it = skip.lower_bound(probe);
+            sink += it != skip.end() ? *it : 0;
+        }
+    }));
+
+    report("std::set", "lower_bound", n, time_ms([&] {
+        for (int probe : probes)
+        {
+            auto it = tree.lower_bound(probe);
+            sink += it != tree.end() ? *it : 0;
+        }
+    }));
+
+    // In-order iteration
+    report("SortedList", "iterate", n, time_ms([&] {
+        for (int value : skip)
+        {
+            sink += value;
+        }
+    }));
+
+    report("std::set", "iterate", n, time_ms([&] {
+        for (int value : tree)
+        {
+            sink += value;
+        }
+    }));
+
+    // Bulk construction from a sorted range
+    std::vector<int> sorted(keys);
+    std::sort(sorted.begin(), sorted.end());
+
+    report("SortedList", "bulk build", n, time_ms([&] {
+        SortedList<int> built(sorted.begin(), sorted.end());
+        sink += static_cast<long>(built.size());
+    }));
+
+    report("std::set", "bulk build", n, time_ms([&] {
+        std::multiset<int> built(sorted.begin(), sorted.end());
+        sink += static_cast<long>(built.size());
+    }));
+
+    // Erase by key
+    report("SortedList", "erase(key)", n, time_ms([&] {
+        for (int key : keys)
+        {
+            sink += static_cast<long>(skip.erase(key));
+        }
+    }));
+
+    report("std::set", "erase(key)", n, time_ms([&] {
+        for (int key : keys)
+        {
+            sink += static_cast<long>(tree.erase(key));
+        }
+    }));
+
+    // Erase through iterators inside long runs of equal keys
+    {
+        SortedList<int>    dup_skip;
+        std::multiset<int> dup_tree;
+
+        std::vector<SortedList<int>::iterator>    skip_its;
+        std::vector<std::multiset<int>::iterator> tree_its;
+
+        for (int key : keys)
+        {
+            skip_its.push_back(dup_skip.insert(key & 15));
+            tree_its.push_back(dup_tree.insert(key & 15));
+        }
+
+        // Same random order for both containers
+        std::vector<std::size_t> order(n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            order[i] = i;
+        }
+
+        std::shuffle(order.begin(), order.end(), rng);
+
+        report("SortedList", "erase(it) dups", n, time_ms([&] {
+            for (std::size_t i : order)
+            {
+                dup_skip.erase(skip_its[i]);
+            }
+        }));
+
+        report("std::set", "erase(it) dups", n, time_ms([&] {
+            for (std::size_t i : order)
+            {
+                dup_tree.erase(tree_its[i]);
+            }
+        }));
+
+        sink += static_cast<long>(dup_skip.size() + dup_tree.size());
+    }
+
+    std::printf("checksum %ld\n", sink);
+    return 0;
+}
@@ -0,0 +1,290 @@
+/// @author - Brandon Wallace
+/// @file - bench/bench_timer_wheel.cpp
+/// @brief - TimerWheel with 1M active timers and high churn vs a scanned LL
+///
+/// Build: g++ -std=c++17 -O2 -I. bench/bench_timer_wheel.cpp
+/// Usage: ./a.out [active] [churn-per-tick] [ticks] [ll-active]
+///
+/// Each tick cancels churn random live timers, schedules churn new ones and
+/// advances the clock by one. The baseline is one LL of all timers. Every
+/// tick scans the whole list, and each cancel finds its timer linearly. It
+/// runs with ll-active timers and the same churn ratio.
+///
+/// Global operator new is counted, including the aligned overloads that the
+/// pool's upstream new_delete_resource uses, so the allocations per timer
+/// can be read off directly.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "timer_wheel.hpp"
+
+// -----------------------------------------------------------------------
+
+static std::size_t g_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    g_allocations++;
+
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    g_allocations++;
+
+    // aligned_alloc needs the size rounded up to the alignment
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t bytes = (size + align - 1) / align * align;
+
+    if (void* p = std::aligned_alloc(align, bytes ? bytes : align))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+// -----------------------------------------------------------------------
+
+struct Clock {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::size_t                           allocs = g_allocations;
+
+    void report(const char* name, std::size_t ops, const char* unit) const
+    {
+        double ms = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count();
+
+        std::size_t made = g_allocations - allocs;
+
+        std::printf("%-34s %10.2f ms %9.1f ns/%-6s %9zu allocs %8.4f/%s\n",
+                    name, ms, ms * 1e6 / double(ops), unit,
+                    made, double(made) / double(ops), unit);
+    }
+};
+
+// -----------------------------------------------------------------------
+
+/// Live timers for the wheel: handle per id, swap-remove by position.
+struct WheelDriver {
+    TimerWheel                           wheel;
+    std::vector<TimerWheel::handle_type> handles;
+    std::vector<std::size_t>             position;  ///< Index of id in live.
+    std::vector<std::size_t>             live;
+    std::vector<std::size_t>             free_ids;
+    std::size_t                          fired = 0;
+
+    explicit WheelDriver(std::size_t capacity)
+    {
+        handles.resize(capacity);
+        position.resize(capacity);
+        live.reserve(capacity);
+        free_ids.reserve(capacity);
+
+        for (std::size_t id = capacity; id-- > 0; )
+        {
+            free_ids.push_back(id);
+        }
+    }
+
+    void forget(std::size_t id)
+    {
+        std::size_t at = position[id];
+
+        live[at] = live.back();
+        position[live[at]] = at;
+        live.pop_back();
+        free_ids.push_back(id);
+    }
+
+    void schedule(std::uint64_t delay)
+    {
+        std::size_t id = free_ids.back();
+        free_ids.pop_back();
+
+        position[id] = live.size();
+        live.push_back(id);
+
+        // Two words of capture, small enough for std::function's inline buffer
+        handles[id] = wheel.schedule_after(delay, [this, id] {
+            fired++;
+            forget(id);
+        });
+    }
+
+    void cancel_random(std::mt19937_64& rng)
+    {
+        std::size_t id = live[rng() % live.size()];
+
+        wheel.cancel(handles[id]);
+        forget(id);
+    }
+};
+
+// -----------------------------------------------------------------------
+
+/// Baseline: one LL scanned every tick.
+struct ListDriver {
+    struct Timer {
+        std::uint64_t expires;
+        std::size_t   id;
+    };
+
+    LL<Timer>                list;
+    std::vector<std::size_t> ids;  ///< Live ids, for picking victims.
+    std::uint64_t            now   = 0;
+    std::size_t              next  = 0;
+    std::size_t              fired = 0;
+
+    void schedule(std::uint64_t delay)
+    {
+        list.push_back(Timer{now + delay, next});
+        ids.push_back(next++);
+    }
+
+    void cancel_random(std::mt19937_64& rng)
+    {
+        std::size_t pick = rng() % ids.size();
+        std::size_t id   = ids[pick];
+
+        ids[pick] = ids.back();
+        ids.pop_back();
+
+        // Linear find, then erase
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            if ((*it).id == id)
+            {
+                list.erase(it);
+                break;
+            }
+        }
+    }
+
+    void advance()
+    {
+        now++;
+
+        // Scans every timer for expiry
+        for (auto it = list.begin(); it != list.end(); )
+        {
+            if ((*it).expires <= now)
+            {
+                it = list.erase(it);
+                fired++;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        ids.resize(list.size());
+
+        std::size_t i = 0;
+
+        for (auto& timer : list)
+        {
+            ids[i++] = timer.id;
+        }
+    }
+};
+
+// -----------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    std::size_t   active    = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::size_t   churn     = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+    std::size_t   ticks     = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1000;
+    std::size_t   ll_active = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 10000;
+    std::uint64_t horizon   = 4 * active;  ///< Delays are uniform in [1, horizon].
+
+    std::mt19937_64 rng(5);
+
+    std::printf("active: %zu  churn/tick: %zu  ticks: %zu  ll-active: %zu\n",
+                active, churn, ticks, ll_active);
+
+    // --- TimerWheel ---
+    {
+        WheelDriver driver(active + churn * 2);
+
+        Clock fill;
+        for (std::size_t i = 0; i < active; ++i)
+        {
+            driver.schedule(1 + rng() % horizon);
+        }
+        fill.report("wheel: schedule (cold pool)", active, "timer");
+
+        Clock churning;
+        for (std::size_t t = 0; t < ticks; ++t)
+        {
+            for (std::size_t k = 0; k < churn; ++k)
+            {
+                driver.cancel_random(rng);
+                driver.schedule(1 + rng() % horizon);
+            }
+
+            driver.wheel.advance(driver.wheel.now() + 1);
+        }
+        churning.report("wheel: cancel+schedule+tick", ticks * churn, "op");
+
+        std::printf("%-34s %zu active, %zu fired\n", "wheel: after churn",
+                    driver.wheel.size(), driver.fired);
+
+        // Drains the tail, cascading through every level in use
+        Clock drain;
+        std::size_t remaining = driver.wheel.size();
+        driver.wheel.advance(driver.wheel.now() + horizon + 1);
+        drain.report("wheel: fire remaining", remaining, "timer");
+    }
+
+    // --- Scanned LL baseline, same churn ratio ---
+    {
+        ListDriver driver;
+        std::size_t ll_churn = churn * ll_active / active;
+        std::size_t ll_ticks = ticks;
+
+        ll_churn = ll_churn == 0 ? 1 : ll_churn;
+
+        for (std::size_t i = 0; i < ll_active; ++i)
+        {
+            driver.schedule(1 + rng() % (4 * ll_active));
+        }
+
+        Clock churning;
+        for (std::size_t t = 0; t < ll_ticks; ++t)
+        {
+            for (std::size_t k = 0; k < ll_churn; ++k)
+            {
+                driver.cancel_random(rng);
+                driver.schedule(1 + rng() % (4 * ll_active));
+            }
+
+            driver.advance();
+        }
+        churning.report("scanned LL: cancel+schedule+tick", ll_ticks * ll_churn, "op");
+
+        std::printf("%-34s %zu active, %zu fired\n", "scanned LL: after churn",
+                    driver.list.size(), driver.fired);
+    }
+
+    return 0;
+}
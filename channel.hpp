@@ -0,0 +1,472 @@
+/// @author - Brandon Wallace
+/// @file - channel.hpp
+/// @brief - Coroutine Channel and Executors (C++20)
+
+#ifndef channel_hpp
+#define channel_hpp
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "dll.cpp"
+#include "scheduler.hpp"
+
+// ----------------------------------------------------------------------------
+
+/// Executor is the interface a Channel uses to resume coroutines it has
+/// suspended. Resumption always goes through schedule(); a Channel never
+/// resumes a coroutine inline on the thread that woke it.
+
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    /// ----------------------------------------------------------------------
+    /// @name schedule
+    /// @param handle   holds the coroutine to resume
+    /// ----------------------------------------------------------------------
+    virtual void schedule(std::coroutine_handle<> handle) = 0;
+};
+
+// ----------------------------------------------------------------------------
+
+/// LoopExecutor runs coroutines on the thread that calls run(). Ready
+/// coroutines wait on an LL until the loop gets to them.
+///
+/// @note Not thread-safe; every coroutine must be scheduled from the loop's
+///       own thread.
+
+class LoopExecutor : public Executor {
+public:
+    void schedule(std::coroutine_handle<> handle) override
+    {
+        m_ready.push_back(handle);
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @name run
+    /// @note Resumes ready coroutines until none are left.
+    /// ----------------------------------------------------------------------
+    void run()
+    {
+        while (!m_ready.empty())
+        {
+            std::coroutine_handle<> handle = m_ready.front();
+            m_ready.pop_front();
+            handle.resume();
+        }
+    }
+
+private:
+    LL<std::coroutine_handle<>> m_ready;
+};
+
+// ----------------------------------------------------------------------------
+
+/// PoolExecutor resumes coroutines on the workers of a Scheduler.
+
+class PoolExecutor : public Executor {
+public:
+    explicit PoolExecutor(Scheduler& scheduler) : m_scheduler(scheduler) {}
+
+    void schedule(std::coroutine_handle<> handle) override
+    {
+        m_scheduler.submit([handle] { handle.resume(); });
+    }
+
+private:
+    Scheduler& m_scheduler;
+};
+
+// ----------------------------------------------------------------------------
+
+/// Task is the return type of a detached coroutine. It does not run until it
+/// is handed to spawn(), and it frees its own frame when it finishes.
+
+class Task {
+public:
+    struct promise_type {
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never  final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    Task(Task&& other) noexcept
+    : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    ~Task()
+    {
+        // Destroys a task that was never spawned
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle)
+    : m_handle(handle) {}
+
+    friend void spawn(Executor& executor, Task task);
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/// ----------------------------------------------------------------------
+/// @name spawn
+/// @param executor   holds the executor the task first runs on
+/// @param task       holds the task to start
+/// ----------------------------------------------------------------------
+inline void spawn(Executor& executor, Task task)
+{
+    executor.schedule(std::exchange(task.m_handle, nullptr));
+}
+
+// ----------------------------------------------------------------------------
+
+/// Channel is a bounded multi-producer, multi-consumer queue for coroutines.
+/// Buffered values are kept in an LL. A sender suspends while the buffer is
+/// full and a receiver suspends while it is empty; neither spins.
+///
+/// A value sent while a receiver is waiting is handed to that receiver
+/// directly and never touches the buffer.
+///
+/// @note T must be copyable, since LL stores elements by copy.
+
+template <class T>
+class Channel {
+private:
+  /// @brief A suspended receiver and the slot its value is delivered to.
+  struct Receiver {
+      std::coroutine_handle<> handle;
+      std::optional<T>*       slot;
+  };
+
+  /// @brief A suspended sender, the value it carries, and its result flag.
+  struct Sender {
+      std::coroutine_handle<> handle;
+      const T*                value;
+      bool*                   ok;
+  };
+
+  public:
+    // member types
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    // -----------------------------------------------------------------------
+
+    class SendAwaiter {
+    public:
+        SendAwaiter(Channel& ch, T value) : m_ch(ch), m_value(std::move(value)) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume() const noexcept { return m_ok; }
+
+    private:
+        Channel& m_ch;
+        T        m_value;
+        bool     m_ok = false;
+    };
+
+    class RecvAwaiter {
+    public:
+        explicit RecvAwaiter(Channel& ch) : m_ch(ch) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        std::optional<T> await_resume() { return std::move(m_slot); }
+
+    private:
+        Channel&         m_ch;
+        std::optional<T> m_slot;
+    };
+
+    class RecvBatchAwaiter {
+    public:
+        RecvBatchAwaiter(Channel& ch, size_type n) : m_ch(ch), m_n(n) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        LL<T> await_resume();
+
+    private:
+        Channel&         m_ch;
+        size_type        m_n;
+        LL<T>            m_batch;
+        std::optional<T> m_slot;
+    };
+
+    /// ----------------------------------------------------------------------
+    /// @name Channel
+    /// @param executor   holds the executor suspended coroutines resume on
+    /// @param capacity   number of values buffered before send() suspends
+    /// ----------------------------------------------------------------------
+    explicit Channel(Executor& executor, size_type capacity = 64)
+    : m_executor(executor), m_capacity(capacity == 0 ? 1 : capacity),
+      m_closed(false) {}
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @name send
+    /// @param value   holds the value to send
+    /// @note co_await send(v) suspends while the buffer is full.
+    /// @return an awaitable yielding false if the channel was closed
+    /// ----------------------------------------------------------------------
+    SendAwaiter send(T value) { return SendAwaiter(*this, std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @name recv
+    /// @note co_await recv() suspends while the buffer is empty.
+    /// @return an awaitable yielding the value, or nullopt once the channel
+    ///         is closed and drained
+    /// ----------------------------------------------------------------------
+    RecvAwaiter recv() { return RecvAwaiter(*this); }
+
+    /// ----------------------------------------------------------------------
+    /// @name recv_n
+    /// @param n   maximum number of values to take
+    /// @note Suspends only while the buffer is empty, then takes whatever is
+    ///       available up to n under a single lock.
+    /// @return an awaitable yielding an LL of 1..n values, or an empty LL
+    ///         once the channel is closed and drained
+    /// ----------------------------------------------------------------------
+    RecvBatchAwaiter recv_n(size_type n) { return RecvBatchAwaiter(*this, n); }
+
+    /// ----------------------------------------------------------------------
+    /// @name close
+    /// @note Wakes every suspended coroutine. Pending receivers get nullopt
+    ///       and pending senders get false; buffered values can still be
+    ///       received.
+    /// ----------------------------------------------------------------------
+    void close();
+
+private:
+    // Moves the front buffered value into slot and refills the buffer from a
+    // waiting sender, whose handle is returned for scheduling. Caller holds
+    // the lock and has checked the buffer is not empty.
+    std::coroutine_handle<> take(std::optional<T>& slot);
+
+    Executor&    m_executor;
+    size_type    m_capacity;
+    bool         m_closed;
+    std::mutex   m_mutex;
+    LL<T>        m_buffer;
+    LL<Receiver> m_receivers;
+    LL<Sender>   m_senders;
+};
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+template <class T>
+std::coroutine_handle<> Channel<T>::take(std::optional<T>& slot)
+{
+    slot.emplace(m_buffer.front());
+    m_buffer.pop_front();
+
+    if (m_senders.empty())
+    {
+        return nullptr;
+    }
+
+    // A slot just opened up; the oldest waiting sender fills it
+    Sender sender = m_senders.front();
+    m_senders.pop_front();
+
+    m_buffer.push_back(*sender.value);
+    *sender.ok = true;
+
+    return sender.handle;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+bool Channel<T>::SendAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    std::coroutine_handle<> wake = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_ch.m_mutex);
+
+        if (m_ch.m_closed)
+        {
+            return false;
+        }
+
+        // Hands the value straight to a waiting receiver
+        if (!m_ch.m_receivers.empty())
+        {
+            Receiver receiver = m_ch.m_receivers.front();
+            m_ch.m_receivers.pop_front();
+
+            receiver.slot->emplace(std::move(m_value));
+            wake = receiver.handle;
+        }
+        // Buffers the value if there is room
+        else if (m_ch.m_buffer.size() < m_ch.m_capacity)
+        {
+            m_ch.m_buffer.push_back(m_value);
+        }
+        // Otherwise waits for a receiver to make room
+        else
+        {
+            m_ch.m_senders.push_back(Sender{handle, &m_value, &m_ok});
+            return true;
+        }
+
+        m_ok = true;
+    }
+
+    if (wake)
+    {
+        m_ch.m_executor.schedule(wake);
+    }
+
+    return false;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+bool Channel<T>::RecvAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    std::coroutine_handle<> wake = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_ch.m_mutex);
+
+        if (!m_ch.m_buffer.empty())
+        {
+            wake = m_ch.take(m_slot);
+        }
+        // Closed and drained, resumes with nullopt
+        else if (m_ch.m_closed)
+        {
+            return false;
+        }
+        // Otherwise waits for a sender
+        else
+        {
+            m_ch.m_receivers.push_back(Receiver{handle, &m_slot});
+            return true;
+        }
+    }
+
+    if (wake)
+    {
+        m_ch.m_executor.schedule(wake);
+    }
+
+    return false;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+bool Channel<T>::RecvBatchAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    LL<std::coroutine_handle<>> wake;
+    {
+        std::lock_guard<std::mutex> lock(m_ch.m_mutex);
+
+        if (m_ch.m_buffer.empty())
+        {
+            if (m_ch.m_closed)
+            {
+                return false;
+            }
+
+            // Waits for a single value, which becomes a batch of one
+            m_ch.m_receivers.push_back(Receiver{handle, &m_slot});
+            return true;
+        }
+
+        // Drains up to n values under one lock
+        while (m_batch.size() < m_n && !m_ch.m_buffer.empty())
+        {
+            std::coroutine_handle<> sender = m_ch.take(m_slot);
+
+            m_batch.push_back(*m_slot);
+            m_slot.reset();
+
+            if (sender)
+            {
+                wake.push_back(sender);
+            }
+        }
+    }
+
+    for (auto sender : wake)
+    {
+        m_ch.m_executor.schedule(sender);
+    }
+
+    return false;
+}
+
+template <class T>
+LL<T> Channel<T>::RecvBatchAwaiter::await_resume()
+{
+    // Woken by a sender with a single value
+    if (m_slot)
+    {
+        m_batch.push_back(*m_slot);
+    }
+
+    return std::move(m_batch);
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+void Channel<T>::close()
+{
+    LL<std::coroutine_handle<>> wake;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_closed)
+        {
+            return;
+        }
+
+        m_closed = true;
+
+        // Receivers only wait on an empty buffer, so they get nullopt
+        for (auto& receiver : m_receivers)
+        {
+            wake.push_back(receiver.handle);
+        }
+
+        // Senders keep m_ok == false
+        for (auto& sender : m_senders)
+        {
+            wake.push_back(sender.handle);
+        }
+
+        m_receivers.clear();
+        m_senders.clear();
+    }
+
+    for (auto handle : wake)
+    {
+        m_executor.schedule(handle);
+    }
+}
+
+#endif /* channel_hpp */
@@ -2,6 +2,9 @@
 /// @file - dll.cpp
 /// @brief - Doubly Linked List Container
 
+#ifndef dll_cpp
+#define dll_cpp
+
 #include "dll.hpp"
 
 // =======================================================================
@@ -90,7 +93,8 @@ template <class T>
 LL<T>::LL(LL&& other)
 : count(std::exchange(other.count, 0)),
   head(std::exchange(other.head, nullptr)),
-  tail(std::exchange(other.tail, nullptr))
+  tail(std::exchange(other.tail, nullptr)),
+  source(other.source)
 {}
 
 // Copy Assignment
@@ -102,8 +106,13 @@ LL<T>& LL<T>::operator=(const LL& rhs)
     // Checks for self-assignment
     if (this != &rhs) {
         
-        // Creates a temporary copy of rhs
-        LL<T> cpy = rhs;
+        // Creates a temporary copy of rhs from this list's node source
+        LL<T> cpy(source);
+
+        for (const auto& element : rhs)
+        {
+            cpy.push_back(element);
+        }
 
         // Swaps the contents of *this with the copy
         std::swap(count, cpy.count);
@@ -125,9 +134,10 @@ LL<T>& LL<T>::operator=(LL&& rhs)
     if (this != &rhs) {
         clear();
 
-        count = std::exchange(rhs.count, 0);
-        head  = std::exchange(rhs.head, nullptr);
-        tail  = std::exchange(rhs.tail, nullptr);
+        count  = std::exchange(rhs.count, 0);
+        head   = std::exchange(rhs.head, nullptr);
+        tail   = std::exchange(rhs.tail, nullptr);
+        source = rhs.source;
     }
 
     return *this;
@@ -224,7 +234,7 @@ void LL<T>::clear()
 
         head = head->next;
 
-        delete tmp;
+        destroy_node(tmp);
     }
 
     tail = nullptr;
@@ -259,7 +269,7 @@ typename LL<T>::iterator LL<T>::erase(iterator pos)
             tail = nullptr;
         }
         
-        delete current;
+        destroy_node(current);
         
         // Decrements the count in the container
         count--;
@@ -273,7 +283,7 @@ typename LL<T>::iterator LL<T>::erase(iterator pos)
         
         tail->next = nullptr;
         
-        delete current;
+        destroy_node(current);
         
         // Decrements the count in the container
         count--;
@@ -289,7 +299,7 @@ typename LL<T>::iterator LL<T>::erase(iterator pos)
         
         auto nextNode = current->next;
         
-        delete current;
+        destroy_node(current);
         
         // Decrements the count in the container
         count--;
@@ -307,7 +317,7 @@ typename LL<T>::iterator LL<T>::insert(iterator pos, const value_type& value)
     Node* current = pos.operator->();
     
     // Creates a new node with the given value
-    Node* newNode = new Node{value};
+    Node* newNode = create_node(value);
     newNode->next = nullptr;
     newNode->prev = nullptr;
     
@@ -370,8 +380,23 @@ typename LL<T>::iterator LL<T>::insert(iterator pos, const value_type& value)
 template <class T>
 void LL<T>::push_back(const value_type& value)
 {
-    // Creates a new node with the given value
-    Node* newNode = new Node{value};
+    emplace_back(value);
+}
+
+template <class T>
+void LL<T>::push_back(value_type&& value)
+{
+    emplace_back(std::move(value));
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+template <class... Args>
+typename LL<T>::reference LL<T>::emplace_back(Args&&... args)
+{
+    // Creates a new node with an element built from args
+    Node* newNode = create_node(std::forward<Args>(args)...);
     
     newNode->next = nullptr;
     
@@ -397,6 +422,8 @@ void LL<T>::push_back(const value_type& value)
     
     // Increments the count of the container
     count++;
+
+    return newNode->data;
 }
 
 // -----------------------------------------------------------------------
@@ -413,7 +440,7 @@ void LL<T>::pop_back()
     // Handles the case when there is only one node in the list
     if (head == tail && count == 1)
     {
-        delete head;
+        destroy_node(head);
         
         head = nullptr;
         
@@ -427,7 +454,7 @@ void LL<T>::pop_back()
         
         p->next = nullptr;
         
-        delete tail;
+        destroy_node(tail);
         
         tail = p;
     }
@@ -442,8 +469,7 @@ template <class T>
 void LL<T>::push_front(const value_type& value)
 {
     // Create a new node with the given value
-    Node* new_node = new Node();
-    new_node->data = value;
+    Node* new_node = create_node(value);
 
     // Assigns the previous pointer to nullptr
     new_node->prev = nullptr;
@@ -498,7 +524,7 @@ void LL<T>::pop_front()
     }
     
     // Deletes the old head node
-    delete p;
+    destroy_node(p);
     
     // Decrements the count in the list
     count--;
@@ -513,4 +539,328 @@ void LL<T>::swap(LL& other)
     std::swap(count, other.count);
     std::swap(head, other.head);
     std::swap(tail, other.tail);
+    std::swap(source, other.source);
 }
+
+// Node source
+// -----------------------------------------------------------------------
+
+template <class T>
+template <class... Args>
+typename LL<T>::Node* LL<T>::create_node(Args&&... args)
+{
+    // Default source, plain new
+    if (source == nullptr)
+    {
+        return new Node(std::in_place, std::forward<Args>(args)...);
+    }
+
+    void* raw = source->allocate(sizeof(Node), alignof(Node));
+
+    // Returns the memory to the source if constructing the element throws
+    try
+    {
+        return ::new (raw) Node(std::in_place, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        source->deallocate(raw, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+template <class T>
+void LL<T>::destroy_node(Node* node) noexcept
+{
+    if (source == nullptr)
+    {
+        delete node;
+        return;
+    }
+
+    node->~Node();
+    source->deallocate(node, sizeof(Node), alignof(Node));
+}
+
+// Operations
+// -----------------------------------------------------------------------
+
+template <class T>
+typename LL<T>::size_type LL<T>::release(Node* chain) noexcept
+{
+    size_type released = 0;
+
+    // Deletes the detached chain node by node
+    while (chain != nullptr)
+    {
+        Node* tmp = chain;
+
+        chain = chain->next;
+
+        destroy_node(tmp);
+
+        released++;
+    }
+
+    return released;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+typename LL<T>::size_type LL<T>::remove(const value_type& value)
+{
+    // value may alias an element; it stays alive until the batch release
+    return remove_if([&value](const value_type& element) {
+        return element == value;
+    });
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+template <class UnaryPredicate>
+typename LL<T>::size_type LL<T>::remove_if(UnaryPredicate p)
+{
+    // Last survivor linked so far, and the chain of removed nodes
+    Node* last    = nullptr;
+    Node* removed = nullptr;
+    Node* current = head;
+
+    try
+    {
+        while (current != nullptr)
+        {
+            Node* next = current->next;
+
+            if (p(current->data))
+            {
+                // Detaches the node onto the removed chain
+                current->next = removed;
+                removed = current;
+            }
+            else
+            {
+                // Links the survivor after the previous survivor
+                current->prev = last;
+
+                if (last != nullptr)
+                {
+                    last->next = current;
+                }
+                else
+                {
+                    head = current;
+                }
+
+                last = current;
+            }
+
+            current = next;
+        }
+    }
+    catch (...)
+    {
+        // Reattaches the unvisited tail so the list stays well formed
+        if (current != nullptr)
+        {
+            current->prev = last;
+        }
+
+        if (last != nullptr)
+        {
+            last->next = current;
+        }
+        else
+        {
+            head = current;
+        }
+
+        count -= release(removed);
+        throw;
+    }
+
+    // Terminates the survivor chain
+    if (last != nullptr)
+    {
+        last->next = nullptr;
+    }
+    else
+    {
+        head = nullptr;
+    }
+
+    tail = last;
+
+    size_type erased = release(removed);
+
+    // Decrements the count in the container
+    count -= erased;
+
+    return erased;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+typename LL<T>::size_type LL<T>::unique()
+{
+    return unique([](const value_type& a, const value_type& b) {
+        return a == b;
+    });
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+template <class BinaryPredicate>
+typename LL<T>::size_type LL<T>::unique(BinaryPredicate p)
+{
+    // Nothing to compare
+    if (head == nullptr)
+    {
+        return 0;
+    }
+
+    // The first node always survives
+    Node* last    = head;
+    Node* removed = nullptr;
+    Node* current = head->next;
+
+    try
+    {
+        while (current != nullptr)
+        {
+            Node* next = current->next;
+
+            if (p(last->data, current->data))
+            {
+                // Detaches the duplicate onto the removed chain
+                current->next = removed;
+                removed = current;
+            }
+            else
+            {
+                // Links the survivor after the previous survivor
+                current->prev = last;
+                last->next = current;
+                last = current;
+            }
+
+            current = next;
+        }
+    }
+    catch (...)
+    {
+        // Reattaches the unvisited tail so the list stays well formed
+        if (current != nullptr)
+        {
+            current->prev = last;
+        }
+
+        last->next = current;
+
+        count -= release(removed);
+        throw;
+    }
+
+    // Terminates the survivor chain
+    last->next = nullptr;
+    tail = last;
+
+    size_type erased = release(removed);
+
+    // Decrements the count in the container
+    count -= erased;
+
+    return erased;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+void LL<T>::reverse() noexcept
+{
+    Node* current = head;
+
+    // Swaps the links of every node
+    while (current != nullptr)
+    {
+        Node* next = current->next;
+
+        current->next = current->prev;
+        current->prev = next;
+
+        current = next;
+    }
+
+    std::swap(head, tail);
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+void LL<T>::splice(iterator pos, LL& other, iterator it)
+{
+    // Nodes must go back to the source they came from
+    assert(source == other.source);
+
+    Node* node    = it.operator->();
+    Node* current = pos.operator->();
+
+    // Already in place
+    if (node == current || (current == nullptr ? node == tail && &other == this
+                                               : node->next == current))
+    {
+        return;
+    }
+
+    // Unlinks the node from other
+    if (node->prev != nullptr)
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        other.head = node->next;
+    }
+
+    if (node->next != nullptr)
+    {
+        node->next->prev = node->prev;
+    }
+    else
+    {
+        other.tail = node->prev;
+    }
+
+    other.count--;
+
+    // Links the node in before pos, or at the end when pos is end()
+    Node* before = current != nullptr ? current->prev : tail;
+
+    node->prev = before;
+    node->next = current;
+
+    if (before != nullptr)
+    {
+        before->next = node;
+    }
+    else
+    {
+        head = node;
+    }
+
+    if (current != nullptr)
+    {
+        current->prev = node;
+    }
+    else
+    {
+        tail = node;
+    }
+
+    count++;
+}
+
+#endif /* dll_cpp */
@@ -10,7 +10,10 @@
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <utility>
 
 // ----------------------------------------------------------------------------
 
@@ -23,6 +26,9 @@
 /// lists does not invalidate the iterators or references. An iterator is
 /// invalidated only when the corresponding element is deleted.
 ///
+/// Nodes come from plain new unless the list is given a node source, which
+/// can be any std::pmr::memory_resource (e.g. a pool or an arena).
+///
 /// @note Mimics behavior of std::list.
 /// @see https://en.cppreference.com/w/cpp/container/list
 
@@ -39,6 +45,12 @@ private:
       T     data;  ///< The data stored in the Node.
       Node* prev;  ///< A pointer to the previous Node.
       Node* next;  ///< A pointer to the next Node.
+
+      /// @brief Direct-initializes data from args, so one argument is never
+      ///        treated as a cast the way T(arg) would be.
+      template <class... Args>
+      explicit Node(std::in_place_t, Args&&... args)
+      : data(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
   };
 
   // ------------------------------------------------------------------------
@@ -112,7 +124,17 @@ private:
     /// the default value of value_type, e.g., the default value for an
     /// int is 0.
     /// ----------------------------------------------------------------------
-    LL() : count(0), head(nullptr), tail(nullptr) {}
+    LL() : count(0), head(nullptr), tail(nullptr), source(nullptr) {}
+
+    /// ----------------------------------------------------------------------
+    /// @name LL
+    /// @param resource   memory resource every node is allocated from, or
+    ///                   nullptr for plain new/delete
+    /// @note Constructs an empty list. resource must outlive the list. Copies
+    ///       use the default source; moves and swaps carry the source along.
+    /// ----------------------------------------------------------------------
+    explicit LL(std::pmr::memory_resource* resource)
+    : count(0), head(nullptr), tail(nullptr), source(resource) {}
     
     /// ----------------------------------------------------------------------
     /// @name LL
@@ -204,6 +226,11 @@ private:
     // @param: none
     // @return: Returns the size of the container
     size_type size() const {return count;}
+
+    // @name: node_source()
+    // @param: none
+    // @return: Returns the memory resource nodes come from, nullptr for new
+    std::pmr::memory_resource* node_source() const { return source; }
     
     // Modifiers
     // -----------------------------------------------------------------------
@@ -212,15 +239,89 @@ private:
     iterator insert(iterator pos, const value_type& value);
     iterator erase(iterator pos);
     void push_back(const value_type& value);
+    void push_back(value_type&& value);
+
+    /// ----------------------------------------------------------------------
+    /// @name emplace_back
+    /// @param args   arguments forwarded to the constructor of the element
+    /// @note Constructs the element in place in the new node, with no
+    ///       intermediate copy or move.
+    /// @return a reference to the new element
+    /// ----------------------------------------------------------------------
+    template <class... Args>
+    reference emplace_back(Args&&... args);
     void pop_back();
     void push_front(const value_type& value);
     void pop_front();
     void swap(LL& other);
+
+    // Operations
+    // -----------------------------------------------------------------------
+
+    /// ----------------------------------------------------------------------
+    /// @name remove
+    /// @param value   holds the value to compare the elements to
+    /// @note Removes all elements equal to value in a single pass. value may
+    ///       refer to an element of the list.
+    /// @return the number of elements removed
+    /// ----------------------------------------------------------------------
+    size_type remove(const value_type& value);
+
+    /// ----------------------------------------------------------------------
+    /// @name remove_if
+    /// @param p   unary predicate, returns true if the element should go
+    /// @note Walks the list once, relinking survivors as it goes. Removed
+    ///       nodes are collected on a detached chain and freed in one batch.
+    /// @return the number of elements removed
+    /// ----------------------------------------------------------------------
+    template <class UnaryPredicate>
+    size_type remove_if(UnaryPredicate p);
+
+    /// ----------------------------------------------------------------------
+    /// @name unique
+    /// @param p   binary predicate, returns true if the elements are equal
+    /// @note Removes all but the first element of every run of consecutive
+    ///       equal elements. Uses operator== when no predicate is given.
+    /// @return the number of elements removed
+    /// ----------------------------------------------------------------------
+    size_type unique();
+
+    template <class BinaryPredicate>
+    size_type unique(BinaryPredicate p);
+
+    /// ----------------------------------------------------------------------
+    /// @name reverse
+    /// @note Reverses the order of the elements in place. No iterators or
+    ///       references are invalidated.
+    /// ----------------------------------------------------------------------
+    void reverse() noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @name splice
+    /// @param pos     element before which the node is inserted
+    /// @param other   list the node is taken from, may be *this
+    /// @param it      element of other to move
+    /// @note Relinks a single node without copying or reallocating it, so
+    ///       iterators to it stay valid. Both lists must share a node source.
+    /// ----------------------------------------------------------------------
+    void splice(iterator pos, LL& other, iterator it);
   
 private:
-  size_type count;
-  Node*     head;
-  Node*     tail;
+  /// Allocates a node from the list's node source and constructs its element
+  /// from args
+  template <class... Args>
+  Node* create_node(Args&&... args);
+
+  /// Destroys a node and returns its memory to the node source
+  void destroy_node(Node* node) noexcept;
+
+  /// Frees a chain of nodes linked through next and returns how many there were
+  size_type release(Node* chain) noexcept;
+
+  size_type                  count;
+  Node*                      head;
+  Node*                      tail;
+  std::pmr::memory_resource* source;
 };
 
 #endif /* dll_hpp */
@@ -0,0 +1,198 @@
+/// @author - Brandon Wallace
+/// @file - generator.hpp
+/// @brief - Lazy Coroutine Views over LL (C++20)
+
+#ifndef generator_hpp
+#define generator_hpp
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "dll.cpp"
+
+// ----------------------------------------------------------------------------
+
+/// Generator is a lazily evaluated, single-pass sequence produced by a
+/// coroutine, modelled on std::generator. Each element is computed when the
+/// iterator is advanced, so a chain of view(), filter() and map() stages
+/// never builds an intermediate list.
+///
+/// @note A yielded value is only valid until the iterator is advanced.
+
+template <class T>
+class Generator {
+public:
+  struct promise_type {
+      const T*           current = nullptr;  ///< The most recent yielded value.
+      std::exception_ptr error;              ///< Exception thrown by the body.
+
+      Generator get_return_object() {
+          return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+      }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+
+      // The yielded temporary lives until the coroutine is resumed
+      std::suspend_always yield_value(const T& value) noexcept {
+          current = std::addressof(value);
+          return {};
+      }
+
+      void return_void() noexcept {}
+      void unhandled_exception() { error = std::current_exception(); }
+
+      // Generators cannot co_await
+      template <class U>
+      std::suspend_never await_transform(U&&) = delete;
+  };
+
+  // ------------------------------------------------------------------------
+
+  /// @brief Input iterator that resumes the coroutine on every increment.
+
+  class Iterator {
+  public:
+      // Member Types
+      using iterator_category = std::input_iterator_tag;
+      using difference_type   = std::ptrdiff_t;
+      using value_type        = T;
+      using reference         = const T&;
+
+      Iterator() = default;
+      explicit Iterator(std::coroutine_handle<promise_type> h) : m_handle(h) {}
+
+      reference operator*() const { return *m_handle.promise().current; }
+
+      Iterator& operator++() { advance(m_handle); return *this; }
+
+      /// @brief Postfix increment; returns nothing, as for any input iterator.
+      void operator++(int) { ++*this; }
+
+      friend bool operator==(const Iterator& it, std::default_sentinel_t) {
+          return !it.m_handle || it.m_handle.done();
+      }
+
+  private:
+      std::coroutine_handle<promise_type> m_handle;
+  };
+
+  public:
+    // member types
+    using value_type = T;
+    using iterator   = Iterator;
+
+    Generator(Generator&& other) noexcept
+    : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    Generator& operator=(Generator&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+            m_handle = std::exchange(rhs.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~Generator()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    // @name: begin()
+    // @return: Starts the coroutine and returns an iterator to its first value
+    iterator begin()
+    {
+        advance(m_handle);
+        return iterator(m_handle);
+    }
+
+    // @name: end()
+    // @return: Returns the sentinel marking a finished coroutine
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    explicit Generator(std::coroutine_handle<promise_type> h) : m_handle(h) {}
+
+    // Resumes to the next yield and rethrows anything the body threw
+    static void advance(std::coroutine_handle<promise_type> h)
+    {
+        h.resume();
+
+        if (h.promise().error)
+        {
+            std::rethrow_exception(std::exchange(h.promise().error, nullptr));
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+// =======================================================================
+//                      S T A G E S
+// =======================================================================
+
+/// ----------------------------------------------------------------------
+/// @name view
+/// @param list   holds the list to walk; must outlive the generator
+/// @return a generator yielding each element of list in order
+/// ----------------------------------------------------------------------
+template <class T>
+Generator<T> view(const LL<T>& list)
+{
+    // LL's const_iterator is a const Iterator, so walks with a mutable copy
+    for (typename LL<T>::iterator it = list.begin(); it != list.end(); ++it)
+    {
+        co_yield *it;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @name filter
+/// @param source   holds the upstream stage
+/// @param p        unary predicate, returns true for elements to keep
+/// @return a generator yielding the elements of source that satisfy p
+/// ----------------------------------------------------------------------
+template <class T, class UnaryPredicate>
+Generator<T> filter(Generator<T> source, UnaryPredicate p)
+{
+    for (const T& value : source)
+    {
+        if (p(value))
+        {
+            co_yield value;
+        }
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @name map
+/// @param source   holds the upstream stage
+/// @param f        unary function applied to each element
+/// @return a generator yielding f(x) for each element x of source
+/// ----------------------------------------------------------------------
+template <class T, class UnaryFunction,
+          class R = std::decay_t<std::invoke_result_t<UnaryFunction&, const T&>>>
+Generator<R> map(Generator<T> source, UnaryFunction f)
+{
+    for (const T& value : source)
+    {
+        co_yield f(value);
+    }
+}
+
+#endif /* generator_hpp */
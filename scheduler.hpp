@@ -0,0 +1,378 @@
+/// @author - Brandon Wallace
+/// @file - scheduler.hpp
+/// @brief - Work-Stealing Thread Pool
+
+#ifndef scheduler_hpp
+#define scheduler_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dll.cpp"
+#include "wsdeque.hpp"
+
+// ----------------------------------------------------------------------------
+
+/// Scheduler is a fixed-size thread pool in which every worker owns a WSDeque.
+/// Tasks spawned from a worker go onto that worker's deque; tasks submitted
+/// from outside the pool go onto a shared LL guarded by a mutex. Idle workers
+/// take from their own deque first, then the shared list, then steal from the
+/// top of the other workers' deques.
+///
+/// TaskGroup gives fork-join on top of the pool. A worker waiting on a group
+/// keeps executing pending tasks instead of blocking, so nested groups cannot
+/// starve the pool. A thread outside the pool only yields while it waits.
+///
+/// @note Tasks passed to submit() must not throw; an exception escaping a task
+///       on a worker thread terminates the program. Use a TaskGroup to carry
+///       exceptions back to the waiting thread.
+
+class Scheduler {
+public:
+    // member types
+    using task_type = std::function<void()>;
+    using size_type = std::size_t;
+
+    /// ----------------------------------------------------------------------
+    /// @name Scheduler
+    /// @param workers   number of worker threads to start
+    /// @note Starts the workers. They sleep until work is submitted.
+    /// ----------------------------------------------------------------------
+    explicit Scheduler(size_type workers =
+                           std::max(1u, std::thread::hardware_concurrency()));
+
+    /// ----------------------------------------------------------------------
+    /// @name ~Scheduler
+    /// @note Destructor. Stops and joins the workers; tasks that have not
+    ///       started yet are discarded.
+    /// ----------------------------------------------------------------------
+    ~Scheduler() noexcept;
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @name submit
+    /// @param task   holds the callable to run
+    /// @note Pushes onto the calling worker's own deque, or onto the shared
+    ///       list when called from a thread outside the pool.
+    /// ----------------------------------------------------------------------
+    void submit(task_type task);
+
+    /// ----------------------------------------------------------------------
+    /// @name run_one
+    /// @note Finds one pending task and runs it on the calling thread. The
+    ///       task is released even if it throws, and the exception propagates.
+    /// @return true if a task was run, false if none could be found
+    /// ----------------------------------------------------------------------
+    bool run_one();
+
+    // @name: workers()
+    // @return: Returns the number of worker threads
+    size_type workers() const { return m_workers.size(); }
+
+    // @name: is_worker()
+    // @return: Returns true if the calling thread is a worker of this pool
+    bool is_worker() const { return current_index() != npos; }
+
+private:
+    struct Worker {
+        WSDeque<task_type*> deque;
+        std::thread         thread;
+    };
+
+    void      loop(size_type index);
+    task_type* find_task(size_type index);
+    size_type current_index() const;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::mutex                           m_mutex;
+    std::condition_variable              m_wakeup;
+    LL<task_type*>                       m_injected;       ///< Guarded by m_mutex.
+    std::atomic<size_type>               m_injected_size;  ///< Read without the lock.
+    std::atomic<size_type>               m_pending;        ///< Queued, not started.
+    std::atomic<size_type>               m_sleepers;
+    std::atomic<bool>                    m_stop;
+};
+
+// ----------------------------------------------------------------------------
+
+/// TaskGroup tracks a set of tasks spawned on a Scheduler and lets the caller
+/// wait for all of them. The destructor waits as well.
+///
+/// A task that throws still counts as finished. The first exception thrown by
+/// any task in the group is rethrown from wait().
+
+class TaskGroup {
+public:
+    explicit TaskGroup(Scheduler& scheduler)
+    : m_scheduler(scheduler), m_pending(0), m_failed(false) {}
+
+    ~TaskGroup() { drain(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @name run
+    /// @param fn   holds the callable to run as part of this group
+    /// ----------------------------------------------------------------------
+    template <class F>
+    void run(F&& fn)
+    {
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        m_scheduler.submit([this, fn = std::forward<F>(fn)]() mutable {
+            try
+            {
+                fn();
+            }
+            catch (...)
+            {
+                // Keeps the first exception; later ones are dropped
+                if (!m_failed.exchange(true, std::memory_order_relaxed))
+                {
+                    m_error = std::current_exception();
+                }
+            }
+
+            m_pending.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @name wait
+    /// @note Waits until every task in the group has finished, then rethrows
+    ///       the first task exception. On a worker, the wait runs pending
+    ///       tasks instead of blocking.
+    /// ----------------------------------------------------------------------
+    void wait()
+    {
+        drain();
+
+        if (m_error)
+        {
+            // Every task has finished, so the flag can be rearmed for reuse
+            m_failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+
+private:
+    void drain()
+    {
+        // A thread outside the pool spawns onto the shared FIFO. If it also
+        // ran tasks while waiting, it would take the oldest ones, and each of
+        // those could nest another wait inside this one without bound.
+        bool help = m_scheduler.is_worker();
+
+        while (m_pending.load(std::memory_order_acquire) != 0)
+        {
+            if (!help || !m_scheduler.run_one())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    Scheduler&               m_scheduler;
+    std::atomic<std::size_t> m_pending;
+    std::atomic<bool>        m_failed;
+    std::exception_ptr       m_error;  ///< Published by the m_pending release.
+};
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+namespace scheduler_detail {
+    // Identifies the pool and worker slot of the calling thread
+    inline thread_local const Scheduler* tls_owner = nullptr;
+    inline thread_local std::size_t      tls_index = 0;
+}
+
+inline Scheduler::Scheduler(size_type workers)
+: m_injected_size(0), m_pending(0), m_sleepers(0), m_stop(false)
+{
+    workers = std::max<size_type>(1, workers);
+
+    // Creates every deque before any thread can try to steal from it
+    for (size_type i = 0; i < workers; ++i)
+    {
+        m_workers.emplace_back(new Worker());
+    }
+
+    for (size_type i = 0; i < workers; ++i)
+    {
+        m_workers[i]->thread = std::thread([this, i] { loop(i); });
+    }
+}
+
+inline Scheduler::~Scheduler() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop.store(true);
+    }
+    m_wakeup.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker->thread.join();
+    }
+
+    // Releases tasks that never ran
+    task_type* task = nullptr;
+
+    for (auto& worker : m_workers)
+    {
+        while (worker->deque.pop(task))
+        {
+            delete task;
+        }
+    }
+
+    for (auto* pending : m_injected)
+    {
+        delete pending;
+    }
+}
+
+// -----------------------------------------------------------------------
+
+inline Scheduler::size_type Scheduler::current_index() const
+{
+    return scheduler_detail::tls_owner == this ? scheduler_detail::tls_index
+                                               : npos;
+}
+
+// -----------------------------------------------------------------------
+
+inline void Scheduler::submit(task_type task)
+{
+    task_type* node = new task_type(std::move(task));
+    size_type index = current_index();
+
+    // Counts the task before it is visible so a thief never sees it uncounted
+    m_pending.fetch_add(1);
+
+    if (index != npos)
+    {
+        m_workers[index]->deque.push(node);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_injected.push_back(node);
+        m_injected_size.fetch_add(1);
+    }
+
+    // Taking the lock orders this notify after a sleeper's predicate check
+    if (m_sleepers.load() != 0)
+    {
+        { std::lock_guard<std::mutex> lock(m_mutex); }
+        m_wakeup.notify_one();
+    }
+}
+
+// -----------------------------------------------------------------------
+
+inline Scheduler::task_type* Scheduler::find_task(size_type index)
+{
+    task_type* task = nullptr;
+
+    // Own deque first, newest task
+    if (index != npos && m_workers[index]->deque.pop(task))
+    {
+        return task;
+    }
+
+    // Then the shared list, oldest task. Skips the lock while it is empty;
+    // a task missed here keeps m_pending raised, so the caller comes back.
+    if (m_injected_size.load() != 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_injected.empty())
+        {
+            task = m_injected.front();
+            m_injected.pop_front();
+            m_injected_size.fetch_sub(1);
+            return task;
+        }
+    }
+
+    // Then steal from the other workers, starting after our own slot
+    size_type n     = m_workers.size();
+    size_type start = index == npos ? 0 : index + 1;
+
+    for (size_type k = 0; k < n; ++k)
+    {
+        size_type victim = (start + k) % n;
+
+        if (victim != index && m_workers[victim]->deque.steal(task))
+        {
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------
+
+inline bool Scheduler::run_one()
+{
+    task_type* task = find_task(current_index());
+
+    if (task == nullptr)
+    {
+        return false;
+    }
+
+    m_pending.fetch_sub(1);
+
+    // Releases the task even if it throws
+    std::unique_ptr<task_type> owned(task);
+    (*owned)();
+
+    return true;
+}
+
+// -----------------------------------------------------------------------
+
+inline void Scheduler::loop(size_type index)
+{
+    scheduler_detail::tls_owner = this;
+    scheduler_detail::tls_index = index;
+
+    while (!m_stop.load(std::memory_order_relaxed))
+    {
+        if (run_one())
+        {
+            continue;
+        }
+
+        // Sleeps until something is queued; a failed steal with work still
+        // pending just loops around and tries again
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_sleepers.fetch_add(1);
+        m_wakeup.wait(lock, [this] {
+            return m_stop.load() || m_pending.load() != 0;
+        });
+        m_sleepers.fetch_sub(1);
+    }
+}
+
+#endif /* scheduler_hpp */
@@ -0,0 +1,731 @@
+/// @author - Brandon Wallace
+/// @file - sorted_list.hpp
+/// @brief - Ordered Skip List Container
+
+#ifndef sorted_list_hpp
+#define sorted_list_hpp
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+/// SortedList is a container that keeps its elements ordered by Compare and
+/// supports insertion, removal and search in expected logarithmic time. The
+/// class is implemented as a skip list whose bottom level is a doubly-linked
+/// list, so in-order bidirectional iteration works exactly as it does for LL.
+///
+/// Equal elements are allowed and kept in insertion order. Elements are
+/// immutable through iterators, since changing one could break the order.
+/// Inserting and erasing do not invalidate iterators to other elements.
+///
+/// @note Mimics behavior of std::multiset.
+/// @see https://en.cppreference.com/w/cpp/container/multiset
+
+template <class T, class Compare = std::less<T>>
+class SortedList {
+private:
+  static constexpr int MaxLevel = 32;  ///< Tallest possible tower.
+
+  /// @brief Template struct representing a Node in the skip list.
+  ///
+  /// The Node holds its data and a tower of height forward and height
+  /// backward pointers, stored right after it in the same allocation. The
+  /// backward pointers let erase(iterator) unlink a Node without a search.
+
+  struct Node {
+      T      data;    ///< The data stored in the Node.
+      int    height;  ///< Number of levels this Node is linked into.
+      Node** next;    ///< next[l] is the following Node on level l.
+      Node** prev;    ///< prev[l] is the preceding Node on level l, or nullptr.
+  };
+
+  // ------------------------------------------------------------------------
+
+  /// @brief Bidirectional iterator over the bottom level of the skip list.
+  ///
+  /// Supports dereferencing, prefix increment, prefix decrement, and
+  /// comparison ops, like LL's iterator.
+
+  class Iterator {
+  public:
+      // Member Types
+      using iterator_category = std::bidirectional_iterator_tag;  ///< The iterator category.
+      using difference_type   = std::ptrdiff_t;                   ///< The difference type.
+      using value_type        = T;                                ///< The value type.
+      using pointer           = const T*;                         ///< The pointer type.
+      using reference         = const T&;                         ///< The reference type.
+
+      /// @brief Constructs an Iterator object.
+      /// @param ptr A pointer to the node the iterator points to.
+      explicit Iterator(Node* ptr = nullptr) : m_ptr(ptr) {}
+
+      /// @brief Dereferences the iterator.
+      /// @return A const reference to the value the iterator points to.
+      reference operator*() const { return m_ptr->data; }
+
+      /// @brief Returns a pointer to the value the iterator points to.
+      pointer operator->() const { return &m_ptr->data; }
+
+      /// @brief Advances the iterator to the next element.
+      Iterator& operator++() { m_ptr = m_ptr->next[0]; return *this; }
+
+      /// @brief Moves the iterator to the previous element.
+      Iterator& operator--() { m_ptr = m_ptr->prev[0]; return *this; }
+
+      /// @brief Compares two iterators for equality.
+      friend bool operator==(const Iterator& a, const Iterator& b) {
+          return a.m_ptr == b.m_ptr;
+      }
+
+      /// @brief Compares two iterators for inequality.
+      friend bool operator!=(const Iterator& a, const Iterator& b) {
+          return a.m_ptr != b.m_ptr;
+      }
+
+  private:
+      friend class SortedList;
+
+      Node* m_ptr;  ///< A pointer to the node the iterator points to.
+  };
+
+  public:
+    // member types
+    using value_type      = T;
+    using key_compare     = Compare;
+    using size_type       = std::size_t;
+    using reference       = const value_type&;
+    using const_reference = const value_type&;
+    using iterator        = Iterator;
+    using const_iterator  = Iterator;
+
+    /// ----------------------------------------------------------------------
+    /// @name SortedList
+    /// @param comp   holds the comparison function object
+    /// @note Default constructor. Constructs an empty container.
+    /// ----------------------------------------------------------------------
+    explicit SortedList(const Compare& comp = Compare());
+
+    /// ----------------------------------------------------------------------
+    /// @name SortedList
+    /// @param first, last   range of elements already sorted by comp
+    /// @param comp          holds the comparison function object
+    /// @note Bulk-builds the skip list in O(n) by linking each element at the
+    ///       back of every level it belongs to. Tower heights are assigned
+    ///       deterministically, which gives a perfectly balanced list.
+    /// ----------------------------------------------------------------------
+    template <class InputIt>
+    SortedList(InputIt first, InputIt last, const Compare& comp = Compare());
+
+    /// ----------------------------------------------------------------------
+    /// @name SortedList
+    /// @param ilist   used to initialize the elements, in any order
+    /// ----------------------------------------------------------------------
+    SortedList(std::initializer_list<T> ilist, const Compare& comp = Compare());
+
+    /// ----------------------------------------------------------------------
+    /// @name SortedList
+    /// @param other    holds a reference to other SortedList
+    /// @note Copy-Constructor. Rebuilds the copy in O(n).
+    /// ----------------------------------------------------------------------
+    SortedList(const SortedList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @name SortedList
+    /// @param other    holds the other SortedList
+    /// @note Move-Constructor. After the move, other is guaranteed to be empty()
+    /// ----------------------------------------------------------------------
+    SortedList(SortedList&& other) noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @name ~SortedList
+    /// @note Destructor.
+    /// ----------------------------------------------------------------------
+    ~SortedList() noexcept { clear(); }
+
+    SortedList& operator=(const SortedList& rhs);
+    SortedList& operator=(SortedList&& rhs) noexcept;
+
+    // Element access functions
+    // -----------------------------------------------------------------------
+
+    // @name: front() & back()
+    // @return: Returns the smallest or largest element
+    // @note: Throws std::out_of_range if the container is empty
+    const_reference front() const;
+    const_reference back() const;
+
+    // Iterators
+    // -----------------------------------------------------------------------
+
+    iterator begin() const { return iterator(m_head[0]); }
+    iterator end() const { return iterator(nullptr); }
+
+    // Capacity
+    // -----------------------------------------------------------------------
+
+    bool empty() const { return m_count == 0; }
+    size_type size() const { return m_count; }
+
+    // Modifiers
+    // -----------------------------------------------------------------------
+
+    void clear() noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @name insert
+    /// @param value   holds the value to insert
+    /// @note Inserts after any elements equal to value. Expected O(log n).
+    /// @return an iterator to the inserted element
+    /// ----------------------------------------------------------------------
+    iterator insert(const value_type& value);
+
+    /// ----------------------------------------------------------------------
+    /// @name erase
+    /// @param pos   iterator to the element to remove
+    /// @note Unlinks the tower through its own links in O(height), which is
+    ///       expected O(1), however many elements are equal to *pos.
+    /// @return an iterator to the element following the removed one
+    /// ----------------------------------------------------------------------
+    iterator erase(iterator pos);
+
+    /// ----------------------------------------------------------------------
+    /// @name erase
+    /// @param key   holds the key to compare the elements to
+    /// @note Removes every element equal to key. The whole run is unlinked
+    ///       in one descent, so this is expected O(log n + k).
+    /// @return the number of elements removed
+    /// ----------------------------------------------------------------------
+    size_type erase(const value_type& key);
+
+    void swap(SortedList& other) noexcept;
+
+    // Lookup
+    // -----------------------------------------------------------------------
+
+    // @name: find(key)
+    // @return: Returns an iterator to the first element equal to key, or end()
+    iterator find(const value_type& key) const;
+
+    // @name: lower_bound(key)
+    // @return: Returns an iterator to the first element not less than key
+    iterator lower_bound(const value_type& key) const;
+
+    // @name: upper_bound(key)
+    // @return: Returns an iterator to the first element greater than key
+    iterator upper_bound(const value_type& key) const;
+
+    // @name: equal_range(key)
+    // @return: Returns the range of elements equal to key
+    std::pair<iterator, iterator> equal_range(const value_type& key) const;
+
+    // @name: key_comp()
+    // @return: Returns the comparison function object
+    key_compare key_comp() const { return m_comp; }
+
+private:
+    // Walks down from the top level, stopping on each level before the first
+    // node for which before() is false. Records the node stopped at on each
+    // level in update when given one (nullptr for the head), and returns the
+    // bottom-level node reached.
+    template <class Before>
+    Node* descend(Before before, Node* update[]) const;
+
+    // Returns the link that follows node on level l; nullptr is the head
+    Node*& link(Node* node, int l) { return node != nullptr ? node->next[l] : m_head[l]; }
+    Node*  link(Node* node, int l) const { return node != nullptr ? node->next[l] : m_head[l]; }
+
+    static Node* create_node(const value_type& value, int height);
+    static void  destroy_node(Node* node) noexcept;
+
+    int random_height() noexcept;
+
+    Compare       m_comp;
+    size_type     m_count;
+    int           m_level;              ///< Number of levels in use.
+    Node*         m_head[MaxLevel];     ///< First node on each level.
+    Node*         m_tail;               ///< Last node on the bottom level.
+    std::uint64_t m_seed;               ///< xorshift state for tower heights.
+};
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+// Node allocation
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::Node*
+SortedList<T, Compare>::create_node(const value_type& value, int height)
+{
+    // Allocates the node and both towers of links in one block
+    void* raw = ::operator new(sizeof(Node) + 2 * height * sizeof(Node*));
+
+    Node* node;
+
+    try
+    {
+        node = ::new (raw) Node{value, height, nullptr, nullptr};
+    }
+    catch (...)
+    {
+        ::operator delete(raw);
+        throw;
+    }
+
+    node->next = reinterpret_cast<Node**>(static_cast<char*>(raw) + sizeof(Node));
+    node->prev = node->next + height;
+
+    return node;
+}
+
+template <class T, class Compare>
+void SortedList<T, Compare>::destroy_node(Node* node) noexcept
+{
+    node->~Node();
+    ::operator delete(node);
+}
+
+template <class T, class Compare>
+int SortedList<T, Compare>::random_height() noexcept
+{
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 7;
+    m_seed ^= m_seed << 17;
+
+    // Each extra level has a one in four chance
+    std::uint64_t bits = m_seed;
+    int height = 1;
+
+    while (height < MaxLevel && (bits & 3) == 0)
+    {
+        height++;
+        bits >>= 2;
+    }
+
+    return height;
+}
+
+// Constructors
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+SortedList<T, Compare>::SortedList(const Compare& comp)
+: m_comp(comp), m_count(0), m_level(0), m_head(), m_tail(nullptr),
+  m_seed(0x9E3779B97F4A7C15ull)
+{}
+
+template <class T, class Compare>
+template <class InputIt>
+SortedList<T, Compare>::SortedList(InputIt first, InputIt last, const Compare& comp)
+: SortedList(comp)
+{
+    // Last node on every level, nullptr while the level is empty
+    Node* back[MaxLevel] = {};
+
+    try
+    {
+        for (; first != last; ++first)
+        {
+            assert((m_tail == nullptr || !m_comp(*first, m_tail->data)) &&
+                   "SortedList range constructor needs a sorted range");
+
+            // Every fourth node climbs one level, every sixteenth two, ...
+            size_type position = m_count + 1;
+            int height = 1;
+
+            while (height < MaxLevel && (position & 3) == 0)
+            {
+                height++;
+                position >>= 2;
+            }
+
+            Node* node = create_node(*first, height);
+
+            for (int l = 0; l < height; ++l)
+            {
+                link(back[l], l) = node;
+                node->prev[l] = back[l];
+                back[l] = node;
+            }
+
+            m_tail = node;
+            m_count++;
+
+            if (height > m_level)
+            {
+                m_level = height;
+            }
+        }
+    }
+    catch (...)
+    {
+        link(back[0], 0) = nullptr;
+        clear();
+        throw;
+    }
+
+    // Terminates every level
+    for (int l = 0; l < MaxLevel; ++l)
+    {
+        link(back[l], l) = nullptr;
+    }
+}
+
+template <class T, class Compare>
+SortedList<T, Compare>::SortedList(std::initializer_list<T> ilist, const Compare& comp)
+: SortedList(comp)
+{
+    for (const auto& element : ilist)
+    {
+        insert(element);
+    }
+}
+
+template <class T, class Compare>
+SortedList<T, Compare>::SortedList(const SortedList& other)
+: SortedList(other.begin(), other.end(), other.m_comp)
+{}
+
+template <class T, class Compare>
+SortedList<T, Compare>::SortedList(SortedList&& other) noexcept
+: SortedList(other.m_comp)
+{
+    swap(other);
+}
+
+// Assignment
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+SortedList<T, Compare>& SortedList<T, Compare>::operator=(const SortedList& rhs)
+{
+    // Checks for self-assignment
+    if (this != &rhs)
+    {
+        SortedList cpy = rhs;
+        swap(cpy);
+    }
+
+    return *this;
+}
+
+template <class T, class Compare>
+SortedList<T, Compare>& SortedList<T, Compare>::operator=(SortedList&& rhs) noexcept
+{
+    // Checks for self-assignment
+    if (this != &rhs)
+    {
+        clear();
+        swap(rhs);
+    }
+
+    return *this;
+}
+
+// Element access functions
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::const_reference SortedList<T, Compare>::front() const
+{
+    if (m_head[0] == nullptr) {
+        throw std::out_of_range("List is empty");
+    }
+
+    return m_head[0]->data;
+}
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::const_reference SortedList<T, Compare>::back() const
+{
+    if (m_tail == nullptr) {
+        throw std::out_of_range("List is empty");
+    }
+
+    return m_tail->data;
+}
+
+// Lookup
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+template <class Before>
+typename SortedList<T, Compare>::Node*
+SortedList<T, Compare>::descend(Before before, Node* update[]) const
+{
+    Node* node = nullptr;
+
+    for (int l = m_level - 1; l >= 0; --l)
+    {
+        // Moves right while the next node still comes before the target
+        while (link(node, l) != nullptr && before(link(node, l)->data))
+        {
+            node = link(node, l);
+        }
+
+        if (update != nullptr)
+        {
+            update[l] = node;
+        }
+    }
+
+    return m_level == 0 ? nullptr : link(node, 0);
+}
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::iterator
+SortedList<T, Compare>::lower_bound(const value_type& key) const
+{
+    return iterator(descend([&](const T& x) { return m_comp(x, key); }, nullptr));
+}
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::iterator
+SortedList<T, Compare>::upper_bound(const value_type& key) const
+{
+    return iterator(descend([&](const T& x) { return !m_comp(key, x); }, nullptr));
+}
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::iterator
+SortedList<T, Compare>::find(const value_type& key) const
+{
+    iterator it = lower_bound(key);
+
+    if (it != end() && !m_comp(key, *it))
+    {
+        return it;
+    }
+
+    return end();
+}
+
+template <class T, class Compare>
+std::pair<typename SortedList<T, Compare>::iterator,
+          typename SortedList<T, Compare>::iterator>
+SortedList<T, Compare>::equal_range(const value_type& key) const
+{
+    // Two descents keep this expected O(log n) however long the equal run is
+    return {lower_bound(key), upper_bound(key)};
+}
+
+// Modifiers
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+void SortedList<T, Compare>::clear() noexcept
+{
+    Node* current = m_head[0];
+
+    while (current != nullptr)
+    {
+        Node* tmp = current;
+
+        current = current->next[0];
+
+        destroy_node(tmp);
+    }
+
+    for (int l = 0; l < MaxLevel; ++l)
+    {
+        m_head[l] = nullptr;
+    }
+
+    m_tail  = nullptr;
+    m_level = 0;
+    m_count = 0;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::iterator
+SortedList<T, Compare>::insert(const value_type& value)
+{
+    Node* update[MaxLevel];
+
+    // Finds the position after any equal elements on every level
+    descend([&](const T& x) { return !m_comp(value, x); }, update);
+
+    int   height = random_height();
+    Node* node   = create_node(value, height);
+
+    // New levels start at the head
+    for (int l = m_level; l < height; ++l)
+    {
+        update[l] = nullptr;
+    }
+
+    if (height > m_level)
+    {
+        m_level = height;
+    }
+
+    // Links the tower in both directions on every level
+    for (int l = 0; l < height; ++l)
+    {
+        Node* successor = link(update[l], l);
+
+        node->next[l] = successor;
+        node->prev[l] = update[l];
+        link(update[l], l) = node;
+
+        if (successor != nullptr)
+        {
+            successor->prev[l] = node;
+        }
+        else if (l == 0)
+        {
+            m_tail = node;
+        }
+    }
+
+    // Increments the count of the container
+    m_count++;
+
+    return iterator(node);
+}
+
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::iterator
+SortedList<T, Compare>::erase(iterator pos)
+{
+    // Iterator points to end(), nothing to erase
+    if (pos == end())
+    {
+        return pos;
+    }
+
+    Node* target = pos.m_ptr;
+
+    // Unlinks the tower from its neighbours on every level it is linked into
+    for (int l = 0; l < target->height; ++l)
+    {
+        Node* before = target->prev[l];
+        Node* after  = target->next[l];
+
+        link(before, l) = after;
+
+        if (after != nullptr)
+        {
+            after->prev[l] = before;
+        }
+        else if (l == 0)
+        {
+            m_tail = before;
+        }
+    }
+
+    Node* successor = target->next[0];
+
+    // Drops levels that are now empty
+    while (m_level > 0 && m_head[m_level - 1] == nullptr)
+    {
+        m_level--;
+    }
+
+    destroy_node(target);
+
+    // Decrements the count in the container
+    m_count--;
+
+    return iterator(successor);
+}
+
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+typename SortedList<T, Compare>::size_type
+SortedList<T, Compare>::erase(const value_type& key)
+{
+    Node* update[MaxLevel];
+
+    Node* first = descend([&](const T& x) { return m_comp(x, key); }, update);
+
+    // Nothing equal to key
+    if (first == nullptr || m_comp(key, first->data))
+    {
+        return 0;
+    }
+
+    // Unlinks the equal run on every level in one step
+    Node* last = nullptr;
+
+    for (int l = 0; l < m_level; ++l)
+    {
+        Node* p = link(update[l], l);
+
+        while (p != nullptr && !m_comp(key, p->data))
+        {
+            p = p->next[l];
+        }
+
+        link(update[l], l) = p;
+
+        if (p != nullptr)
+        {
+            p->prev[l] = update[l];
+        }
+        else if (l == 0)
+        {
+            m_tail = update[l];
+        }
+
+        if (l == 0)
+        {
+            last = p;
+        }
+    }
+
+    // Drops levels that are now empty
+    while (m_level > 0 && m_head[m_level - 1] == nullptr)
+    {
+        m_level--;
+    }
+
+    // Frees the detached run
+    size_type erased = 0;
+
+    while (first != last)
+    {
+        Node* tmp = first;
+
+        first = first->next[0];
+
+        destroy_node(tmp);
+
+        erased++;
+    }
+
+    // Decrements the count in the container
+    m_count -= erased;
+
+    return erased;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T, class Compare>
+void SortedList<T, Compare>::swap(SortedList& other) noexcept
+{
+    // Swaps the private data members of the two containers
+    std::swap(m_comp, other.m_comp);
+    std::swap(m_count, other.m_count);
+    std::swap(m_level, other.m_level);
+    std::swap(m_head, other.m_head);
+    std::swap(m_tail, other.m_tail);
+    std::swap(m_seed, other.m_seed);
+}
+
+#endif /* sorted_list_hpp */
@@ -0,0 +1,192 @@
+/// @author - Brandon Wallace
+/// @file - tests/test_arena.cpp
+/// @brief - Tests for HugePageArena as an LL node source
+///
+/// Build: g++ -std=c++17 -O1 -I. tests/test_arena.cpp
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+#include "arena.hpp"
+#include "dll.cpp"
+
+// -----------------------------------------------------------------------
+
+/// Upstream resource that counts the blocks passed through to it.
+struct CountingResource : std::pmr::memory_resource {
+    int allocations = 0;
+    int live        = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        live++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        live--;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// -----------------------------------------------------------------------
+
+// A freed block is reused by the next request in its size class only
+static void test_free_list_reuse()
+{
+    HugePageArena arena;
+
+    void* a = arena.allocate(24, 8);
+    void* b = arena.allocate(40, 8);
+    assert(arena.stats().chunks == 1);
+
+    arena.deallocate(a, 24, 8);
+
+    // 20 and 24 bytes share the 32-byte class, 40 bytes does not
+    void* c = arena.allocate(40, 8);
+    assert(c != a && c != b);
+
+    void* d = arena.allocate(20, 8);
+    assert(d == a);
+
+    // Last freed, first reused
+    arena.deallocate(b, 40, 8);
+    arena.deallocate(c, 40, 8);
+    assert(arena.allocate(48, 16) == c);
+    assert(arena.allocate(48, 16) == b);
+
+    assert(arena.stats().chunks == 1);
+}
+
+// bytes_used counts whole size classes and drops back to zero
+static void test_bytes_used()
+{
+    HugePageArena arena;
+
+    void* a = arena.allocate(1, 1);
+    assert(arena.stats().bytes_used == 16);
+
+    void* b = arena.allocate(17, 8);
+    assert(arena.stats().bytes_used == 16 + 32);
+
+    void* c = arena.allocate(HugePageArena::max_block, 16);
+    assert(arena.stats().bytes_used == 16 + 32 + HugePageArena::max_block);
+
+    arena.deallocate(b, 17, 8);
+    assert(arena.stats().bytes_used == 16 + HugePageArena::max_block);
+
+    arena.deallocate(a, 1, 1);
+    arena.deallocate(c, HugePageArena::max_block, 16);
+    assert(arena.stats().bytes_used == 0);
+    assert(arena.stats().bytes_mapped == HugePageArena::chunk_size);
+}
+
+// Oversized and over-aligned blocks bypass the arena
+static void test_upstream_passthrough()
+{
+    CountingResource upstream;
+    HugePageArena    arena(false, &upstream);
+
+    void* big = arena.allocate(HugePageArena::max_block + 1, 8);
+    assert(upstream.allocations == 1);
+
+    void* aligned = arena.allocate(64, 64);
+    assert(upstream.allocations == 2);
+    assert(reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0);
+
+    assert(arena.stats().chunks == 0 && arena.stats().bytes_used == 0);
+
+    arena.deallocate(big, HugePageArena::max_block + 1, 8);
+    arena.deallocate(aligned, 64, 64);
+    assert(upstream.live == 0);
+
+    // Small blocks never reach upstream
+    void* small = arena.allocate(HugePageArena::max_block, 16);
+    assert(upstream.allocations == 2 && arena.stats().chunks == 1);
+    arena.deallocate(small, HugePageArena::max_block, 16);
+}
+
+// A block that does not fit the current chunk starts a new one
+static void test_chunk_rollover()
+{
+    HugePageArena arena;
+    std::vector<void*> blocks;
+
+    std::size_t per_chunk = HugePageArena::chunk_size / HugePageArena::max_block;
+
+    for (std::size_t i = 0; i < per_chunk + 1; ++i)
+    {
+        void* p = arena.allocate(HugePageArena::max_block, 16);
+        assert(reinterpret_cast<std::uintptr_t>(p) % 16 == 0);
+        blocks.push_back(p);
+    }
+
+    assert(arena.stats().chunks == 2);
+    assert(arena.stats().bytes_mapped == 2 * HugePageArena::chunk_size);
+    assert(std::set<void*>(blocks.begin(), blocks.end()).size() == blocks.size());
+
+    for (void* p : blocks)
+    {
+        arena.deallocate(p, HugePageArena::max_block, 16);
+    }
+
+    assert(arena.stats().bytes_used == 0);
+}
+
+// An LL backed by the arena returns every node when it is cleared
+static void test_list_nodes()
+{
+    HugePageArena arena;
+    {
+        LL<int> list(&arena);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+
+        std::size_t used = arena.stats().bytes_used;
+        assert(used >= 1000 * sizeof(int) && used % HugePageArena::granule == 0);
+
+        // Every node sits inside the single chunk
+        assert(arena.stats().chunks == 1);
+
+        list.clear();
+        assert(arena.stats().bytes_used == 0);
+
+        // Refilling reuses the freed nodes without another chunk
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+
+        assert(arena.stats().bytes_used == used);
+        assert(list.size() == 1000 && list.back() == 999);
+    }
+    assert(arena.stats().bytes_used == 0 && arena.stats().chunks == 1);
+}
+
+// -----------------------------------------------------------------------
+
+int main()
+{
+    test_free_list_reuse();
+    test_bytes_used();
+    test_upstream_passthrough();
+    test_chunk_rollover();
+    test_list_nodes();
+
+    std::puts("test_arena: all tests passed");
+    return 0;
+}
@@ -0,0 +1,201 @@
+/// @author - Brandon Wallace
+/// @file - tests/test_channel.cpp
+/// @brief - Tests for Channel, the executors and Generator views
+///
+/// Build: g++ -std=c++20 -O1 -pthread -I. tests/test_channel.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "channel.hpp"
+#include "generator.hpp"
+
+static_assert(std::input_iterator<Generator<int>::iterator>);
+static_assert(std::sentinel_for<std::default_sentinel_t, Generator<int>::iterator>);
+static_assert(std::ranges::input_range<Generator<int>>);
+
+// -----------------------------------------------------------------------
+
+static Task produce(Channel<int>& ch, int n, bool close)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        co_await ch.send(i);
+    }
+
+    if (close)
+    {
+        ch.close();
+    }
+}
+
+static Task consume(Channel<int>& ch, std::vector<int>& out)
+{
+    while (auto value = co_await ch.recv())
+    {
+        out.push_back(*value);
+    }
+}
+
+static Task consume_batches(Channel<int>& ch, std::vector<int>& out,
+                            std::size_t& batches, std::atomic<bool>& done)
+{
+    for (;;)
+    {
+        LL<int> batch = co_await ch.recv_n(16);
+
+        if (batch.empty())
+        {
+            break;
+        }
+
+        assert(batch.size() <= 16);
+        batches++;
+
+        for (int value : batch)
+        {
+            out.push_back(value);
+        }
+    }
+
+    done.store(true);
+}
+
+static Task send_after_close(Channel<int>& ch, bool& result)
+{
+    result = co_await ch.send(1);
+}
+
+// -----------------------------------------------------------------------
+
+// Values arrive in order through a buffer smaller than the stream
+static void test_loop_in_order()
+{
+    LoopExecutor loop;
+    Channel<int> ch(loop, 4);
+    std::vector<int> out;
+
+    spawn(loop, consume(ch, out));
+    spawn(loop, produce(ch, 1000, true));
+    loop.run();
+
+    assert(out.size() == 1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        assert(out[i] == i);
+    }
+}
+
+// A closed channel still drains its buffer, then yields nullopt, and
+// rejects new sends
+static void test_close()
+{
+    LoopExecutor loop;
+    Channel<int> ch(loop, 8);
+    std::vector<int> out;
+
+    spawn(loop, produce(ch, 5, true));
+    loop.run();
+
+    spawn(loop, consume(ch, out));
+    loop.run();
+    assert(out.size() == 5);
+
+    bool result = true;
+    spawn(loop, send_after_close(ch, result));
+    loop.run();
+    assert(!result);
+}
+
+static void test_recv_n()
+{
+    LoopExecutor loop;
+    Channel<int> ch(loop, 64);
+    std::vector<int> out;
+    std::size_t batches = 0;
+    std::atomic<bool> done(false);
+
+    spawn(loop, produce(ch, 1000, true));
+    spawn(loop, consume_batches(ch, out, batches, done));
+    loop.run();
+
+    assert(done.load());
+    assert(out.size() == 1000);
+    assert(batches < 1000);
+    assert(std::is_sorted(out.begin(), out.end()));
+}
+
+// Producers and a batching consumer on a thread pool
+static void test_pool()
+{
+    Scheduler scheduler(4);
+    PoolExecutor pool(scheduler);
+    Channel<int> ch(pool, 16);
+    std::vector<int> out;
+    std::size_t batches = 0;
+    std::atomic<bool> done(false);
+
+    spawn(pool, consume_batches(ch, out, batches, done));
+    spawn(pool, produce(ch, 100000, true));
+
+    while (!done.load())
+    {
+        std::this_thread::yield();
+    }
+
+    assert(out.size() == 100000);
+    assert(std::is_sorted(out.begin(), out.end()));
+}
+
+// -----------------------------------------------------------------------
+
+static void test_generator_views()
+{
+    const LL<int> list{1, 2, 3, 4, 5, 6};
+
+    std::vector<std::string> out;
+
+    auto evens = filter(view(list), [](int x) { return x % 2 == 0; });
+
+    for (const std::string& s : map(std::move(evens), [](int x) { return std::to_string(x * 10); }))
+    {
+        out.push_back(s);
+    }
+
+    assert((out == std::vector<std::string>{"20", "40", "60"}));
+
+    // Works with std::ranges algorithms
+    auto gen = view(list);
+    assert(std::ranges::count_if(gen, [](int x) { return x > 2; }) == 4);
+
+    auto again = view(list);
+    auto found = std::ranges::find(again, 4);
+    assert(found != again.end() && *found == 4);
+
+    // Postfix increment
+    auto g = view(list);
+    auto i = g.begin();
+    i++;
+    assert(*i == 2);
+}
+
+// -----------------------------------------------------------------------
+
+int main()
+{
+    test_loop_in_order();
+    test_close();
+    test_recv_n();
+    test_pool();
+    test_generator_views();
+
+    std::puts("test_channel: all tests passed");
+    return 0;
+}
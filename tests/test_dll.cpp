@@ -0,0 +1,414 @@
+/// @author - Brandon Wallace
+/// @file - tests/test_dll.cpp
+/// @brief - Tests for LL bulk operations and node sources
+///
+/// Build: g++ -std=c++17 -O1 -I. tests/test_dll.cpp
+
+#include <cassert>
+#include <cstdio>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "dll.cpp"
+
+// -----------------------------------------------------------------------
+
+/// Element type that tracks how many instances are alive.
+struct Tracked {
+    static int live;
+
+    int value;
+
+    Tracked(int v) : value(v) { live++; }
+    Tracked(const Tracked& other) : value(other.value) { live++; }
+    ~Tracked() { live--; }
+
+    friend bool operator==(const Tracked& a, const Tracked& b) { return a.value == b.value; }
+    friend bool operator!=(const Tracked& a, const Tracked& b) { return a.value != b.value; }
+};
+
+int Tracked::live = 0;
+
+/// Element type that counts copies and moves.
+struct Counted {
+    static int copies;
+    static int moves;
+
+    int value;
+
+    Counted(int v) : value(v) {}
+    Counted(const Counted& other) : value(other.value) { copies++; }
+    Counted(Counted&& other) noexcept : value(other.value) { moves++; }
+};
+
+int Counted::copies = 0;
+int Counted::moves  = 0;
+
+/// Node source that counts the blocks it hands out.
+struct CountingResource : std::pmr::memory_resource {
+    int allocations = 0;
+    int live        = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        live++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        live--;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+static int value_of(int x) { return x; }
+static int value_of(const Tracked& t) { return t.value; }
+
+template <class T>
+static std::vector<int> contents(LL<T>& list)
+{
+    std::vector<int> out;
+
+    for (const auto& element : list)
+    {
+        out.push_back(value_of(element));
+    }
+
+    return out;
+}
+
+// Walks the list backwards from the last node to check the prev links
+template <class T>
+static void check_links(LL<T>& list)
+{
+    std::vector<int> forward = contents(list);
+
+    if (forward.empty())
+    {
+        assert(list.begin() == list.end());
+        return;
+    }
+
+    auto it = list.begin();
+
+    while (&*it != &list.back())
+    {
+        ++it;
+    }
+
+    for (std::size_t i = forward.size(); i-- > 0; --it)
+    {
+        assert(value_of(*it) == forward[i]);
+
+        if (i == 0)
+        {
+            assert(it == list.begin());
+            break;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------
+
+static void test_remove_if()
+{
+    LL<int> list{1, 2, 3, 4, 5, 6, 7, 8};
+
+    assert(list.remove_if([](int x) { return x % 2 == 0; }) == 4);
+    assert((contents(list) == std::vector<int>{1, 3, 5, 7}));
+    assert(list.size() == 4 && list.front() == 1 && list.back() == 7);
+    check_links(list);
+
+    // Removing the ends and everything
+    assert(list.remove_if([](int x) { return x == 1 || x == 7; }) == 2);
+    assert(list.front() == 3 && list.back() == 5);
+    assert(list.remove_if([](int) { return true; }) == 2);
+    assert(list.empty() && list.begin() == list.end());
+    assert(list.remove_if([](int) { return true; }) == 0);
+
+    // The list is usable after being emptied
+    list.push_back(9);
+    assert(list.front() == 9 && list.back() == 9);
+}
+
+// value aliases the first element, which is itself removed
+static void test_remove_aliasing()
+{
+    {
+        LL<Tracked> list{4, 1, 4, 2, 4};
+
+        assert(list.remove(list.front()) == 3);
+        assert((contents(list) == std::vector<int>{1, 2}));
+        assert(list.back().value == 2);
+        check_links(list);
+    }
+
+    assert(Tracked::live == 0);
+}
+
+// A throwing predicate leaves a well-formed list and frees what it removed
+static void test_remove_if_throws()
+{
+    {
+        LL<Tracked> list{1, 2, 3, 4, 5};
+        bool caught = false;
+
+        try
+        {
+            list.remove_if([](const Tracked& t) {
+                if (t.value == 4)
+                {
+                    throw 4;
+                }
+                return t.value % 2 == 0;
+            });
+        }
+        catch (int)
+        {
+            caught = true;
+        }
+
+        assert(caught);
+        assert((contents(list) == std::vector<int>{1, 3, 4, 5}));
+        assert(list.size() == 4 && list.back().value == 5);
+        assert(Tracked::live == 4);
+        check_links(list);
+    }
+
+    assert(Tracked::live == 0);
+}
+
+static void test_unique()
+{
+    LL<int> list{1, 1, 2, 3, 3, 3, 1, 4, 4};
+
+    assert(list.unique() == 4);
+    assert((contents(list) == std::vector<int>{1, 2, 3, 1, 4}));
+    assert(list.back() == 4);
+    check_links(list);
+
+    // Binary predicate compares against the last kept element
+    LL<int> near{1, 2, 3, 10, 11, 20};
+
+    assert(near.unique([](int a, int b) { return b - a <= 1; }) == 2);
+    assert((contents(near) == std::vector<int>{1, 3, 10, 20}));
+
+    LL<int> empty;
+    assert(empty.unique() == 0);
+}
+
+static void test_unique_throws()
+{
+    {
+        LL<Tracked> list{1, 1, 2, 2, 3};
+        bool caught = false;
+
+        try
+        {
+            list.unique([](const Tracked& a, const Tracked& b) {
+                if (b.value == 3)
+                {
+                    throw 3;
+                }
+                return a.value == b.value;
+            });
+        }
+        catch (int)
+        {
+            caught = true;
+        }
+
+        assert(caught);
+        assert((contents(list) == std::vector<int>{1, 2, 3}));
+        assert(list.size() == 3 && list.back().value == 3);
+        check_links(list);
+    }
+
+    assert(Tracked::live == 0);
+}
+
+static void test_reverse()
+{
+    LL<int> list{1, 2, 3, 4};
+
+    list.reverse();
+    assert((contents(list) == std::vector<int>{4, 3, 2, 1}));
+    assert(list.front() == 4 && list.back() == 1);
+    check_links(list);
+
+    list.push_back(0);
+    assert(list.back() == 0);
+
+    LL<int> empty;
+    empty.reverse();
+    assert(empty.empty());
+}
+
+// rvalues are moved into the node, emplace_back builds in place
+static void test_push_back_move()
+{
+    LL<Counted> list;
+    Counted value(1);
+
+    list.push_back(value);
+    assert(Counted::copies == 1 && Counted::moves == 0);
+
+    list.push_back(Counted(2));
+    assert(Counted::copies == 1 && Counted::moves == 1);
+
+    Counted& added = list.emplace_back(3);
+    assert(Counted::copies == 1 && Counted::moves == 1);
+    assert(&added == &list.back() && added.value == 3);
+    assert(list.size() == 3 && list.front().value == 1);
+}
+
+// splice relinks nodes between and within lists without invalidating them
+static void test_splice()
+{
+    LL<int> a{1, 2, 3};
+    LL<int> b{4, 5};
+
+    int* four = &*b.begin();
+
+    a.splice(a.begin(), b, b.begin());
+    assert((contents(a) == std::vector<int>{4, 1, 2, 3}));
+    assert((contents(b) == std::vector<int>{5}));
+    assert(&a.front() == four);
+    check_links(a);
+    check_links(b);
+
+    // Within one list, to the end
+    a.splice(a.end(), a, a.begin());
+    assert((contents(a) == std::vector<int>{1, 2, 3, 4}));
+    assert(&a.back() == four);
+    check_links(a);
+
+    // Already in place
+    auto last = a.begin();
+    ++last; ++last; ++last;
+    a.splice(a.end(), a, last);
+    assert((contents(a) == std::vector<int>{1, 2, 3, 4}));
+
+    // Emptying the source list
+    a.splice(a.end(), b, b.begin());
+    assert(b.empty() && b.begin() == b.end());
+    assert(a.size() == 5 && a.back() == 5);
+    check_links(a);
+}
+
+// Nodes come from the list's source and go back to it
+static void test_node_source()
+{
+    CountingResource pool;
+    {
+        LL<int> list(&pool);
+
+        list.push_back(1);
+        list.push_back(2);
+        list.push_back(3);
+        assert(list.node_source() == &pool);
+        assert(pool.allocations == 3 && pool.live == 3);
+
+        list.pop_front();
+        assert(pool.live == 2);
+    }
+    assert(pool.live == 0);
+
+    // The default source is plain new
+    LL<int> plain;
+    assert(plain.node_source() == nullptr);
+}
+
+// Copies use the default source; copy-assignment keeps the destination's
+static void test_node_source_copy()
+{
+    CountingResource pool;
+    CountingResource other;
+    {
+        LL<int> list(&pool);
+        list.push_back(1);
+        list.push_back(2);
+
+        LL<int> copy(list);
+        assert(copy.node_source() == nullptr);
+        assert((contents(copy) == std::vector<int>{1, 2}));
+        assert(pool.allocations == 2);
+
+        LL<int> target(&other);
+        target.push_back(9);
+
+        target = list;
+        assert(target.node_source() == &other);
+        assert((contents(target) == std::vector<int>{1, 2}));
+        assert(other.allocations == 3 && other.live == 2);
+        assert(pool.allocations == 2);
+    }
+    assert(pool.live == 0 && other.live == 0);
+}
+
+// Moves and swaps carry the source along with the nodes
+static void test_node_source_move()
+{
+    CountingResource pool;
+    CountingResource other;
+    {
+        LL<int> list(&pool);
+        list.push_back(1);
+        list.push_back(2);
+
+        LL<int> moved(std::move(list));
+        assert(moved.node_source() == &pool);
+        assert((contents(moved) == std::vector<int>{1, 2}));
+        assert(pool.allocations == 2 && pool.live == 2);
+
+        // The target's old nodes go back to its old source
+        LL<int> target(&other);
+        target.push_back(9);
+
+        target = std::move(moved);
+        assert(target.node_source() == &pool);
+        assert(other.live == 0 && pool.live == 2);
+
+        LL<int> plain;
+        plain.push_back(7);
+
+        plain.swap(target);
+        assert(plain.node_source() == &pool);
+        assert(target.node_source() == nullptr);
+        assert((contents(plain) == std::vector<int>{1, 2}));
+        assert((contents(target) == std::vector<int>{7}));
+
+        // Further nodes come from the swapped-in source
+        plain.push_back(3);
+        assert(pool.allocations == 3 && pool.live == 3);
+    }
+    assert(pool.live == 0 && other.live == 0);
+}
+
+// -----------------------------------------------------------------------
+
+int main()
+{
+    test_remove_if();
+    test_remove_aliasing();
+    test_remove_if_throws();
+    test_unique();
+    test_unique_throws();
+    test_reverse();
+    test_push_back_move();
+    test_splice();
+    test_node_source();
+    test_node_source_copy();
+    test_node_source_move();
+
+    std::puts("test_dll: all tests passed");
+    return 0;
+}
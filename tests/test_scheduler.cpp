@@ -0,0 +1,228 @@
+/// @author - Brandon Wallace
+/// @file - tests/test_scheduler.cpp
+/// @brief - Tests for WSDeque, Scheduler and TaskGroup
+///
+/// Build: g++ -std=c++17 -O1 -pthread -I. tests/test_scheduler.cpp
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "scheduler.hpp"
+
+// -----------------------------------------------------------------------
+
+// Owner push/pop is LIFO and survives several segment doublings
+static void test_push_pop_grow()
+{
+    WSDeque<int> deque(2);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        deque.push(i);
+    }
+    assert(deque.size() == 1000);
+
+    int value = -1;
+
+    for (int i = 999; i >= 0; --i)
+    {
+        assert(deque.pop(value));
+        assert(value == i);
+    }
+
+    assert(!deque.pop(value));
+    assert(deque.empty());
+}
+
+// Thieves take from the top, in FIFO order
+static void test_steal_order()
+{
+    WSDeque<int> deque;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        deque.push(i);
+    }
+
+    int value = -1;
+
+    assert(deque.steal(value) && value == 0);
+    assert(deque.steal(value) && value == 1);
+    assert(deque.pop(value) && value == 9);
+    assert(deque.size() == 7);
+}
+
+// Every element is taken exactly once while the owner grows the deque
+static void test_concurrent_steal()
+{
+    const int n = 200000;
+
+    WSDeque<int>                  deque(4);
+    std::vector<std::atomic<int>> seen(n);
+    std::atomic<bool>             done(false);
+    std::atomic<int>              taken(0);
+
+    std::vector<std::thread> thieves;
+
+    for (int t = 0; t < 3; ++t)
+    {
+        thieves.emplace_back([&] {
+            int value;
+
+            while (!done.load() || !deque.empty())
+            {
+                if (deque.steal(value))
+                {
+                    seen[value].fetch_add(1);
+                    taken.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    int value;
+
+    for (int i = 0; i < n; ++i)
+    {
+        deque.push(i);
+
+        // Pops now and then so the owner races thieves on the last element
+        if (i % 7 == 0 && deque.pop(value))
+        {
+            seen[value].fetch_add(1);
+            taken.fetch_add(1);
+        }
+    }
+
+    while (deque.pop(value))
+    {
+        seen[value].fetch_add(1);
+        taken.fetch_add(1);
+    }
+
+    done.store(true);
+
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    assert(taken.load() == n);
+
+    for (int i = 0; i < n; ++i)
+    {
+        assert(seen[i].load() == 1);
+    }
+}
+
+// -----------------------------------------------------------------------
+
+static long fib(Scheduler& scheduler, int n)
+{
+    if (n < 16)
+    {
+        return n < 2 ? n : fib(scheduler, n - 1) + fib(scheduler, n - 2);
+    }
+
+    long a = 0, b = 0;
+
+    TaskGroup group(scheduler);
+    group.run([&] { a = fib(scheduler, n - 1); });
+    b = fib(scheduler, n - 2);
+    group.wait();
+
+    return a + b;
+}
+
+static void test_fork_join()
+{
+    Scheduler scheduler(4);
+
+    assert(fib(scheduler, 27) == 196418);
+
+    std::atomic<int> count(0);
+    {
+        TaskGroup group(scheduler);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            group.run([&] { count.fetch_add(1); });
+        }
+    }
+
+    assert(count.load() == 10000);
+}
+
+// A throwing task finishes the group and its exception reaches wait()
+static void test_task_group_exception()
+{
+    Scheduler scheduler(2);
+
+    std::atomic<int> count(0);
+    TaskGroup group(scheduler);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        group.run([&, i] {
+            count.fetch_add(1);
+
+            if (i == 42)
+            {
+                throw std::runtime_error("task failed");
+            }
+        });
+    }
+
+    bool caught = false;
+
+    try
+    {
+        group.wait();
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    assert(caught);
+    assert(count.load() == 100);
+
+    // The group is reusable once the error has been reported
+    group.run([&] { count.fetch_add(1); });
+    group.wait();
+    assert(count.load() == 101);
+
+    // A second failure is reported as well
+    group.run([] { throw std::logic_error("second"); });
+
+    caught = false;
+
+    try
+    {
+        group.wait();
+    }
+    catch (const std::logic_error&)
+    {
+        caught = true;
+    }
+
+    assert(caught);
+}
+
+// -----------------------------------------------------------------------
+
+int main()
+{
+    test_push_pop_grow();
+    test_steal_order();
+    test_concurrent_steal();
+    test_fork_join();
+    test_task_group_exception();
+
+    std::puts("test_scheduler: all tests passed");
+    return 0;
+}
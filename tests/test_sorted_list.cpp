@@ -0,0 +1,313 @@
+/// @author - Brandon Wallace
+/// @file - tests/test_sorted_list.cpp
+/// @brief - Randomised tests for SortedList against std::multiset
+///
+/// Build: g++ -std=c++17 -O1 -I. tests/test_sorted_list.cpp
+
+#include <cassert>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "sorted_list.hpp"
+
+// -----------------------------------------------------------------------
+
+// Compares contents in both directions and the front/back accessors
+template <class List, class Ref>
+static void check_equal(const List& list, const Ref& ref)
+{
+    assert(list.size() == ref.size());
+    assert(list.empty() == ref.empty());
+
+    auto r = ref.begin();
+
+    for (auto it = list.begin(); it != list.end(); ++it, ++r)
+    {
+        assert(*it == *r);
+    }
+
+    if (list.empty())
+    {
+        return;
+    }
+
+    assert(list.front() == *ref.begin());
+    assert(list.back() == *ref.rbegin());
+
+    // Walks backwards from the last element
+    auto it = list.begin();
+
+    for (std::size_t i = 1; i < list.size(); ++i)
+    {
+        ++it;
+    }
+
+    for (auto rr = ref.rbegin(); rr != ref.rend(); ++rr)
+    {
+        assert(*it == *rr);
+
+        if (std::next(rr) != ref.rend())
+        {
+            --it;
+        }
+    }
+
+    assert(it == list.begin());
+}
+
+// -----------------------------------------------------------------------
+
+static void test_random_ops()
+{
+    std::mt19937 rng(1);
+
+    SortedList<int>    list;
+    std::multiset<int> ref;
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        int key = static_cast<int>(rng() % 2000);
+
+        switch (rng() % 6)
+        {
+        case 0:
+        case 1:
+        {
+            auto it = list.insert(key);
+            ref.insert(key);
+            assert(*it == key);
+            break;
+        }
+        case 2:
+            assert(list.erase(key) == ref.erase(key));
+            break;
+        case 3:
+        {
+            auto it = list.find(key);
+
+            if (it != list.end())
+            {
+                assert(*it == key);
+                list.erase(it);
+                ref.erase(ref.find(key));
+            }
+            else
+            {
+                assert(ref.count(key) == 0);
+            }
+            break;
+        }
+        case 4:
+        {
+            auto range = list.equal_range(key);
+            auto expect = ref.equal_range(key);
+
+            assert(std::distance(range.first, range.second) ==
+                   std::distance(expect.first, expect.second));
+            break;
+        }
+        default:
+        {
+            auto lo = list.lower_bound(key);
+            auto hi = list.upper_bound(key);
+            auto rlo = ref.lower_bound(key);
+            auto rhi = ref.upper_bound(key);
+
+            assert((lo == list.end()) == (rlo == ref.end()));
+            assert((hi == list.end()) == (rhi == ref.end()));
+            assert(lo == list.end() || *lo == *rlo);
+            assert(hi == list.end() || *hi == *rhi);
+            break;
+        }
+        }
+
+        if (i % 10000 == 0)
+        {
+            check_equal(list, ref);
+        }
+    }
+
+    check_equal(list, ref);
+}
+
+// Long runs of equal keys, where equal_range must still be two descents
+static void test_duplicates()
+{
+    SortedList<int>    list;
+    std::multiset<int> ref;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        list.insert(i % 3);
+        ref.insert(i % 3);
+    }
+
+    auto range = list.equal_range(1);
+    assert(std::distance(range.first, range.second) == 1667);
+    assert(*range.first == 1 && *range.second == 2);
+
+    assert(list.erase(1) == 1667);
+    ref.erase(1);
+    check_equal(list, ref);
+
+    assert(list.erase(7) == 0);
+    assert(list.find(1) == list.end());
+}
+
+// Orders (key, id) pairs by key only, so equal keys keep insertion order
+struct ByKey {
+    bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const
+    {
+        return a.first < b.first;
+    }
+};
+
+// erase(iterator) inside long equal runs unlinks exactly that element
+static void test_erase_in_duplicates()
+{
+    using Item = std::pair<int, int>;
+
+    std::mt19937 rng(3);
+
+    SortedList<Item, ByKey>    list;
+    std::multiset<Item, ByKey> ref;
+
+    // Iterators stay valid across other erasures in both containers
+    std::vector<SortedList<Item, ByKey>::iterator>    handles;
+    std::vector<std::multiset<Item, ByKey>::iterator> ref_handles;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        Item item(static_cast<int>(rng() % 4), i);
+
+        handles.push_back(list.insert(item));
+        ref_handles.push_back(ref.insert(item));
+    }
+
+    // Random positions within the runs, through stored iterators
+    for (int i = 0; i < 15000; ++i)
+    {
+        std::size_t k = rng() % handles.size();
+
+        list.erase(handles[k]);
+        ref.erase(ref_handles[k]);
+
+        handles[k] = handles.back();
+        handles.pop_back();
+        ref_handles[k] = ref_handles.back();
+        ref_handles.pop_back();
+    }
+
+    check_equal(list, ref);
+
+    // Every level is still linked correctly for searches and inserts
+    for (int key = 0; key < 4; ++key)
+    {
+        auto range  = list.equal_range(Item(key, 0));
+        auto expect = ref.equal_range(Item(key, 0));
+
+        assert(std::distance(range.first, range.second) ==
+               std::distance(expect.first, expect.second));
+
+        list.insert(Item(key, -1));
+        ref.insert(Item(key, -1));
+    }
+
+    check_equal(list, ref);
+
+    // Back to front through an all-equal bulk-built list
+    std::vector<Item> same;
+
+    for (int i = 0; i < 50000; ++i)
+    {
+        same.emplace_back(0, i);
+    }
+
+    SortedList<Item, ByKey> run(same.begin(), same.end());
+
+    auto last = run.begin();
+    std::advance(last, run.size() - 1);
+
+    while (!run.empty())
+    {
+        auto before = last;
+
+        if (before != run.begin())
+        {
+            --before;
+        }
+
+        assert(run.erase(last) == run.end());
+        same.pop_back();
+        last = before;
+
+        if (same.size() % 5000 == 0)
+        {
+            check_equal(run, same);
+        }
+    }
+
+    assert(run.begin() == run.end());
+}
+
+static void test_bulk_and_copy()
+{
+    std::vector<int> sorted;
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        sorted.push_back(i / 3);
+    }
+
+    SortedList<int>    list(sorted.begin(), sorted.end());
+    std::multiset<int> ref(sorted.begin(), sorted.end());
+    check_equal(list, ref);
+
+    // The bulk-built list keeps working as a normal skip list
+    list.insert(5);
+    ref.insert(5);
+    list.erase(7);
+    ref.erase(7);
+    check_equal(list, ref);
+
+    SortedList<int> copy = list;
+    check_equal(copy, ref);
+
+    SortedList<int> moved(std::move(copy));
+    check_equal(moved, ref);
+    assert(copy.empty() && copy.begin() == copy.end());
+
+    copy = moved;
+    check_equal(copy, ref);
+
+    SortedList<int> empty(sorted.begin(), sorted.begin());
+    assert(empty.empty());
+}
+
+static void test_custom_compare()
+{
+    SortedList<int, std::greater<int>> list{3, 1, 2, 3};
+    std::multiset<int, std::greater<int>> ref{3, 1, 2, 3};
+
+    check_equal(list, ref);
+    assert(list.front() == 3 && list.back() == 1);
+}
+
+// -----------------------------------------------------------------------
+
+int main()
+{
+    test_random_ops();
+    test_duplicates();
+    test_erase_in_duplicates();
+    test_bulk_and_copy();
+    test_custom_compare();
+
+    std::puts("test_sorted_list: all tests passed");
+    return 0;
+}
@@ -0,0 +1,183 @@
+/// @author - Brandon Wallace
+/// @file - tests/test_timer_wheel.cpp
+/// @brief - Tests for TimerWheel
+///
+/// Build: g++ -std=c++17 -O1 -I. tests/test_timer_wheel.cpp
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "timer_wheel.hpp"
+
+// -----------------------------------------------------------------------
+
+// Every timer fires exactly on its tick, cancelled ones never fire, across
+// near and far deadlines that exercise every cascade level
+static void test_random_schedule_cancel()
+{
+    std::mt19937_64 rng(3);
+
+    TimerWheel wheel(5);
+
+    const int max_timers = 300000;
+
+    std::vector<std::uint64_t> expires(max_timers);
+    std::vector<bool>          pending(max_timers, false);
+    std::vector<std::pair<TimerWheel::handle_type, int>> live;
+    int ids = 0;
+
+    for (int round = 0; round < 2000; ++round)
+    {
+        for (int k = 0; k < 100; ++k)
+        {
+            std::uint64_t delay = rng() % 4 == 0 ? rng() % (std::uint64_t(1) << (rng() % 40))
+                                                 : rng() % 1000;
+            int id = ids++;
+
+            expires[id] = std::max(wheel.now() + delay, wheel.now() + 1);
+            pending[id] = true;
+
+            live.push_back({wheel.schedule_after(delay, [&, id] {
+                assert(pending[id]);
+                assert(wheel.now() == expires[id]);
+                pending[id] = false;
+            }), id});
+        }
+
+        for (int k = 0; k < 30 && !live.empty(); ++k)
+        {
+            std::size_t i = rng() % live.size();
+
+            if (pending[live[i].second])
+            {
+                wheel.cancel(live[i].first);
+                pending[live[i].second] = false;
+            }
+
+            live[i] = live.back();
+            live.pop_back();
+        }
+
+        wheel.advance(wheel.now() + rng() % 700);
+
+        // Forgets handles whose timers have fired
+        std::size_t kept = 0;
+
+        for (auto& entry : live)
+        {
+            if (pending[entry.second])
+            {
+                live[kept++] = entry;
+            }
+        }
+
+        live.resize(kept);
+    }
+
+    std::size_t outstanding = 0;
+
+    for (int i = 0; i < ids; ++i)
+    {
+        outstanding += pending[i] ? 1 : 0;
+    }
+
+    assert(wheel.size() == outstanding);
+
+    wheel.advance(~std::uint64_t(0) >> 1);
+    assert(wheel.empty());
+
+    for (int i = 0; i < ids; ++i)
+    {
+        assert(!pending[i]);
+    }
+}
+
+// A callback can cancel a later timer in the same batch
+static void test_cancel_within_batch()
+{
+    TimerWheel wheel;
+    int fired = 0;
+
+    TimerWheel::handle_type second;
+
+    wheel.schedule_at(10, [&] { fired++; wheel.cancel(second); });
+    second = wheel.schedule_at(10, [&] { fired += 100; });
+
+    assert(wheel.advance(10) == 1);
+    assert(fired == 1);
+    assert(wheel.empty());
+}
+
+// A throwing callback leaves the rest of its batch pending and cancellable,
+// and they fire on the next advance without waiting for the wheel to wrap
+static void test_throwing_callback()
+{
+    TimerWheel wheel;
+    std::vector<int> order;
+
+    wheel.schedule_at(10, [&] { order.push_back(1); throw std::runtime_error("boom"); });
+    TimerWheel::handle_type second = wheel.schedule_at(10, [&] { order.push_back(2); });
+    wheel.schedule_at(10, [&] { order.push_back(3); });
+    wheel.schedule_at(11, [&] { order.push_back(4); });
+
+    bool caught = false;
+
+    try
+    {
+        wheel.advance(20);
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    assert(caught);
+    assert(order.size() == 1);
+    assert(wheel.size() == 3);
+    assert(wheel.now() == 10);
+
+    wheel.cancel(second);
+    assert(wheel.size() == 2);
+
+    assert(wheel.advance(20) == 2);
+    assert((order == std::vector<int>{1, 3, 4}));
+    assert(wheel.empty());
+}
+
+// Past deadlines run on the next tick; an empty wheel jumps straight ahead
+static void test_edges()
+{
+    TimerWheel wheel(100);
+    int fired = 0;
+
+    wheel.schedule_at(50, [&] { fired++; });
+    wheel.schedule_after(0, [&] { fired++; });
+
+    assert(wheel.advance(100) == 0);
+    assert(wheel.advance(101) == 2);
+    assert(fired == 2);
+
+    wheel.advance(std::uint64_t(1) << 60);
+    assert(wheel.now() == std::uint64_t(1) << 60);
+
+    wheel.schedule_after(std::uint64_t(1) << 50, [&] { fired++; });
+    wheel.advance((std::uint64_t(1) << 60) + (std::uint64_t(1) << 50));
+    assert(fired == 3);
+}
+
+// -----------------------------------------------------------------------
+
+int main()
+{
+    test_random_schedule_cancel();
+    test_cancel_within_batch();
+    test_throwing_callback();
+    test_edges();
+
+    std::puts("test_timer_wheel: all tests passed");
+    return 0;
+}
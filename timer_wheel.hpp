@@ -0,0 +1,346 @@
+/// @author - Brandon Wallace
+/// @file - timer_wheel.hpp
+/// @brief - Hierarchical Timing Wheel
+
+#ifndef timer_wheel_hpp
+#define timer_wheel_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "dll.cpp"
+
+// ----------------------------------------------------------------------------
+
+/// TimerWheel keeps pending timers in a hierarchy of wheels whose slots are
+/// LLs. There are 8 levels of 256 slots. A slot on level l covers 256^l ticks,
+/// so the wheel spans the whole 64-bit tick range.
+///
+/// Each timer sits on the level given by the highest byte in which its expiry
+/// differs from the current tick. When the lower levels wrap around, the
+/// matching slot one level up is cascaded down. Its nodes are spliced into
+/// lower slots rather than copied, so handles stay valid. An expiring
+/// bottom-level slot is swapped out as a whole batch before its callbacks run.
+///
+/// All timer nodes come from one std::pmr::unsynchronized_pool_resource.
+/// Once the pool is warm, scheduling a timer does not call the allocator.
+///
+/// @note Not thread-safe. Ticks are plain integers; the caller picks the unit.
+
+class TimerWheel {
+private:
+  static constexpr int           Levels = 8;
+  static constexpr int           Bits   = 8;
+  static constexpr std::uint64_t Slots  = std::uint64_t(1) << Bits;
+  static constexpr std::uint8_t  Firing = 0xFF;  ///< Level of a due timer.
+
+  /// @brief A pending timer and where it currently lives.
+  struct Entry {
+      std::uint64_t         expires;   ///< Tick the timer is due.
+      std::function<void()> callback;  ///< What to run when it is due.
+      std::uint8_t          level;     ///< Wheel level, or Firing.
+      std::uint8_t          slot;      ///< Slot within the level.
+  };
+
+  public:
+    // member types
+    using size_type     = std::size_t;
+    using tick_type     = std::uint64_t;
+    using callback_type = std::function<void()>;
+
+    /// A handle to a scheduled timer. It stores the iterator of the timer's
+    /// node. It is invalidated once the timer fires or is cancelled.
+    using handle_type   = LL<Entry>::iterator;
+
+    /// ----------------------------------------------------------------------
+    /// @name TimerWheel
+    /// @param now   tick the wheel starts at
+    /// ----------------------------------------------------------------------
+    explicit TimerWheel(tick_type now = 0);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @name schedule_at
+    /// @param expires    tick the timer is due; past ticks mean the next tick
+    /// @param callback   holds the callable to run
+    /// @note O(1).
+    /// @return a handle that can be passed to cancel()
+    /// ----------------------------------------------------------------------
+    handle_type schedule_at(tick_type expires, callback_type callback);
+
+    /// ----------------------------------------------------------------------
+    /// @name schedule_after
+    /// @param delay      ticks from now until the timer is due
+    /// @param callback   holds the callable to run
+    /// ----------------------------------------------------------------------
+    handle_type schedule_after(tick_type delay, callback_type callback)
+    {
+        return schedule_at(m_now + delay, std::move(callback));
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @name cancel
+    /// @param handle   holds the handle returned when the timer was scheduled
+    /// @note O(1). The timer must still be pending. A callback may cancel
+    ///       other timers that are due in the same batch.
+    /// ----------------------------------------------------------------------
+    void cancel(handle_type handle);
+
+    /// ----------------------------------------------------------------------
+    /// @name advance
+    /// @param now   tick to move the wheel to
+    /// @note Runs the callbacks of every timer due at or before now, in
+    ///       expiry order. Callbacks may schedule and cancel timers.
+    ///
+    ///       If a callback throws, the exception propagates. The timers left
+    ///       in its batch stay pending and cancellable, and they run first
+    ///       on the next call to advance().
+    /// @return the number of timers that fired
+    /// ----------------------------------------------------------------------
+    size_type advance(tick_type now);
+
+    // @name: now()
+    // @return: Returns the tick the wheel has advanced to
+    tick_type now() const { return m_now; }
+
+    // @name: size()
+    // @return: Returns the number of pending timers
+    size_type size() const { return m_size; }
+
+    // @name: empty()
+    // @return: Returns true if no timers are pending
+    bool empty() const { return m_size == 0; }
+
+private:
+    LL<Entry>& bucket(int level, std::uint64_t slot)
+    {
+        return m_slots[level * Slots + slot];
+    }
+
+    // Moves a node from list into the slot its expiry maps to
+    void place(LL<Entry>& list, handle_type it);
+
+    // Cascades the slot at level that the current tick has just reached
+    void cascade(int level);
+
+    // Runs the timers in m_firing and returns how many ran
+    size_type fire_batch();
+
+    std::pmr::unsynchronized_pool_resource m_pool;
+    std::vector<LL<Entry>>                 m_slots;
+    LL<Entry>                              m_staging;  ///< New timers start here.
+    LL<Entry>                              m_firing;   ///< Current due batch.
+    tick_type                              m_now;
+    size_type                              m_size;
+    size_type                              m_pending[Levels];  ///< Per level.
+};
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+inline TimerWheel::TimerWheel(tick_type now)
+: m_staging(&m_pool), m_firing(&m_pool), m_now(now), m_size(0),
+  m_pending()
+{
+    m_slots.reserve(Levels * Slots);
+
+    for (std::uint64_t i = 0; i < Levels * Slots; ++i)
+    {
+        m_slots.emplace_back(&m_pool);
+    }
+}
+
+// -----------------------------------------------------------------------
+
+inline void TimerWheel::place(LL<Entry>& list, handle_type it)
+{
+    Entry& entry = *it;
+
+    // Picks the level from the highest byte that differs from now
+    std::uint64_t diff  = entry.expires ^ m_now;
+    int           level = 0;
+
+    while (level < Levels - 1 && (diff >> (Bits * (level + 1))) != 0)
+    {
+        level++;
+    }
+
+    std::uint64_t slot = (entry.expires >> (Bits * level)) & (Slots - 1);
+
+    entry.level = static_cast<std::uint8_t>(level);
+    entry.slot  = static_cast<std::uint8_t>(slot);
+    m_pending[level]++;
+
+    LL<Entry>& target = bucket(level, slot);
+    target.splice(target.end(), list, it);
+}
+
+// -----------------------------------------------------------------------
+
+inline TimerWheel::handle_type
+TimerWheel::schedule_at(tick_type expires, callback_type callback)
+{
+    // Past and current ticks are due on the next tick
+    if (expires <= m_now)
+    {
+        expires = m_now + 1;
+    }
+
+    // Builds the node once, then splices it into its slot
+    m_staging.push_back(Entry{expires, std::move(callback), 0, 0});
+
+    handle_type it = m_staging.begin();
+    place(m_staging, it);
+
+    // Increments the count of pending timers
+    m_size++;
+
+    return it;
+}
+
+// -----------------------------------------------------------------------
+
+inline void TimerWheel::cancel(handle_type handle)
+{
+    Entry& entry = *handle;
+
+    if (entry.level == Firing)
+    {
+        m_firing.erase(handle);
+    }
+    else
+    {
+        bucket(entry.level, entry.slot).erase(handle);
+        m_pending[entry.level]--;
+    }
+
+    // Decrements the count of pending timers
+    m_size--;
+}
+
+// -----------------------------------------------------------------------
+
+inline void TimerWheel::cascade(int level)
+{
+    std::uint64_t slot = (m_now >> (Bits * level)) & (Slots - 1);
+
+    // Takes the whole slot, then redistributes it onto lower levels
+    LL<Entry> batch(&m_pool);
+    batch.swap(bucket(level, slot));
+    m_pending[level] -= batch.size();
+
+    while (!batch.empty())
+    {
+        place(batch, batch.begin());
+    }
+}
+
+// -----------------------------------------------------------------------
+
+inline TimerWheel::size_type TimerWheel::fire_batch()
+{
+    size_type fired = 0;
+
+    // Pops each timer before its callback runs, so the callback may cancel
+    // the rest of the batch. If a callback throws, the rest stay here.
+    while (!m_firing.empty())
+    {
+        callback_type callback = std::move(m_firing.front().callback);
+        m_firing.pop_front();
+
+        // Decrements the count of pending timers
+        m_size--;
+        fired++;
+
+        callback();
+    }
+
+    return fired;
+}
+
+// -----------------------------------------------------------------------
+
+inline TimerWheel::size_type TimerWheel::advance(tick_type now)
+{
+    // Finishes a batch that an earlier callback interrupted by throwing
+    size_type fired = fire_batch();
+
+    while (m_now < now)
+    {
+        // Finds the lowest level that has anything on it
+        int lowest = 0;
+
+        while (lowest < Levels && m_pending[lowest] == 0)
+        {
+            lowest++;
+        }
+
+        // Nothing pending, jumps straight to now
+        if (lowest == Levels)
+        {
+            m_now = now;
+            break;
+        }
+
+        // Nothing can happen before the next slot boundary of that level,
+        // so skips to the tick just before it
+        if (lowest > 0)
+        {
+            tick_type boundary = m_now | ((std::uint64_t(1) << (Bits * lowest)) - 1);
+
+            if (boundary >= now)
+            {
+                m_now = now;
+                break;
+            }
+
+            m_now = boundary;
+        }
+
+        m_now++;
+
+        // Cascades every level whose lower levels just wrapped, top down
+        int top = 0;
+
+        while (top < Levels - 1 &&
+               (m_now & ((std::uint64_t(1) << (Bits * (top + 1))) - 1)) == 0)
+        {
+            top++;
+        }
+
+        for (int level = top; level > 0; --level)
+        {
+            cascade(level);
+        }
+
+        // Swaps the due slot out as one batch
+        LL<Entry>& due = bucket(0, m_now & (Slots - 1));
+
+        if (due.empty())
+        {
+            continue;
+        }
+
+        m_firing.swap(due);
+
+        m_pending[0] -= m_firing.size();
+
+        for (auto it = m_firing.begin(); it != m_firing.end(); ++it)
+        {
+            (*it).level = Firing;
+        }
+
+        fired += fire_batch();
+    }
+
+    return fired;
+}
+
+#endif /* timer_wheel_hpp */
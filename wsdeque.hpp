@@ -0,0 +1,278 @@
+/// @author - Brandon Wallace
+/// @file - wsdeque.hpp
+/// @brief - Chase-Lev Work-Stealing Deque
+
+#ifndef wsdeque_hpp
+#define wsdeque_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+
+/// WSDeque is a single-owner, multi-thief double-ended queue. The owning thread
+/// pushes and pops at the bottom like a stack, without any atomic
+/// read-modify-write on the fast path. Any other thread may steal from the top
+/// with a single compare-and-swap.
+///
+/// Elements live in a circular segment that doubles when it fills up. Retired
+/// segments are kept on a chain and released when the deque is destroyed, since
+/// a concurrent thief may still be reading from them.
+///
+/// @note T must be trivially copyable; task queues usually store pointers.
+/// @see Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing
+///      for Weak Memory Models", PPoPP 2013.
+
+template <class T>
+class WSDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WSDeque requires a trivially copyable element type");
+
+private:
+  /// @brief Circular backing store for the deque.
+  ///
+  /// Indices grow without bound and are masked into the slot array. Each
+  /// Segment remembers the one it replaced so it can be freed later.
+
+  struct Segment {
+      std::int64_t    capacity;  ///< Number of slots, always a power of two.
+      std::atomic<T>* slots;     ///< The slot array.
+      Segment*        previous;  ///< The segment this one replaced.
+
+      Segment(std::int64_t cap, Segment* prev)
+      : capacity(cap), slots(new std::atomic<T>[cap]), previous(prev) {}
+
+      ~Segment() { delete[] slots; }
+
+      T get(std::int64_t i) const {
+          return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+      }
+
+      void put(std::int64_t i, const T& value) {
+          slots[i & (capacity - 1)].store(value, std::memory_order_relaxed);
+      }
+  };
+
+  public:
+    // member types
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /// ----------------------------------------------------------------------
+    /// @name WSDeque
+    /// @param capacity   initial number of slots, rounded up to a power of two
+    /// @note Constructs an empty deque.
+    /// ----------------------------------------------------------------------
+    explicit WSDeque(size_type capacity = 64);
+
+    /// ----------------------------------------------------------------------
+    /// @name ~WSDeque
+    /// @note Destructor. Releases the current and all retired segments.
+    /// ----------------------------------------------------------------------
+    ~WSDeque() noexcept;
+
+    WSDeque(const WSDeque&) = delete;
+    WSDeque& operator=(const WSDeque&) = delete;
+
+    // Owner operations
+    // -----------------------------------------------------------------------
+
+    /// ----------------------------------------------------------------------
+    /// @name push
+    /// @param value   holds the value to be pushed onto the bottom
+    /// @note Owner thread only. Grows the backing segment when it is full.
+    /// ----------------------------------------------------------------------
+    void push(const value_type& value);
+
+    /// ----------------------------------------------------------------------
+    /// @name pop
+    /// @param out   receives the bottom element
+    /// @note Owner thread only. Only contends with thieves on the last element.
+    /// @return true if an element was popped, false if the deque was empty
+    /// ----------------------------------------------------------------------
+    bool pop(value_type& out);
+
+    // Thief operations
+    // -----------------------------------------------------------------------
+
+    /// ----------------------------------------------------------------------
+    /// @name steal
+    /// @param out   receives the top element
+    /// @note Any thread. May fail spuriously when it loses a race with another
+    ///       thief or with the owner; callers simply try elsewhere.
+    /// @return true if an element was stolen, false otherwise
+    /// ----------------------------------------------------------------------
+    bool steal(value_type& out);
+
+    // Capacity
+    // -----------------------------------------------------------------------
+
+    // @name: size()
+    // @return: Returns a snapshot of the number of elements, which may be
+    //          stale by the time the caller looks at it
+    size_type size() const {
+        std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+        std::int64_t t = m_top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_type>(b - t) : 0;
+    }
+
+    // @name: empty()
+    // @return: Returns true if the snapshot size is 0
+    bool empty() const { return size() == 0; }
+
+private:
+    Segment* grow(Segment* seg, std::int64_t bottom, std::int64_t top);
+
+    alignas(64) std::atomic<std::int64_t> m_top;
+    alignas(64) std::atomic<std::int64_t> m_bottom;
+    alignas(64) std::atomic<Segment*>     m_segment;
+};
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+template <class T>
+WSDeque<T>::WSDeque(size_type capacity)
+: m_top(0), m_bottom(0), m_segment(nullptr)
+{
+    std::int64_t cap = 2;
+    while (cap < static_cast<std::int64_t>(capacity))
+    {
+        cap <<= 1;
+    }
+
+    m_segment.store(new Segment(cap, nullptr), std::memory_order_relaxed);
+}
+
+template <class T>
+WSDeque<T>::~WSDeque() noexcept
+{
+    Segment* seg = m_segment.load(std::memory_order_relaxed);
+
+    while (seg != nullptr)
+    {
+        Segment* prev = seg->previous;
+        delete seg;
+        seg = prev;
+    }
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+typename WSDeque<T>::Segment*
+WSDeque<T>::grow(Segment* seg, std::int64_t bottom, std::int64_t top)
+{
+    // Copies the live range into a segment twice the size; the old one is
+    // retired rather than freed because thieves may still be reading it
+    Segment* bigger = new Segment(seg->capacity * 2, seg);
+
+    for (std::int64_t i = top; i < bottom; ++i)
+    {
+        bigger->put(i, seg->get(i));
+    }
+
+    m_segment.store(bigger, std::memory_order_release);
+
+    return bigger;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+void WSDeque<T>::push(const value_type& value)
+{
+    std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+    std::int64_t t = m_top.load(std::memory_order_acquire);
+    Segment* seg   = m_segment.load(std::memory_order_relaxed);
+
+    // Grows the segment when it is full
+    if (b - t > seg->capacity - 1)
+    {
+        seg = grow(seg, b, t);
+    }
+
+    seg->put(b, value);
+
+    // Publishes the element before the new bottom becomes visible to thieves
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+bool WSDeque<T>::pop(value_type& out)
+{
+    std::int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    Segment* seg   = m_segment.load(std::memory_order_relaxed);
+
+    // Reserves the bottom slot before looking at top
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = m_top.load(std::memory_order_relaxed);
+
+    // Deque was already empty; restores bottom
+    if (t > b)
+    {
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    value_type value = seg->get(b);
+
+    // More than one element left, no thief can reach this slot
+    if (t < b)
+    {
+        out = value;
+        return true;
+    }
+
+    // Last element: races thieves for it through top
+    bool won = m_top.compare_exchange_strong(t, t + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+
+    if (won)
+    {
+        out = value;
+    }
+
+    return won;
+}
+
+// -----------------------------------------------------------------------
+
+template <class T>
+bool WSDeque<T>::steal(value_type& out)
+{
+    std::int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t b = m_bottom.load(std::memory_order_acquire);
+
+    // Checks if the deque is empty
+    if (t >= b)
+    {
+        return false;
+    }
+
+    Segment* seg     = m_segment.load(std::memory_order_acquire);
+    value_type value = seg->get(t);
+
+    // Claims the element; fails if the owner or another thief got there first
+    if (!m_top.compare_exchange_strong(t, t + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    out = value;
+    return true;
+}
+
+#endif /* wsdeque_hpp */